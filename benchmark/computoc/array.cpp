@@ -0,0 +1,488 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <functional>
+#include <algorithm>
+#include <vector>
+#include <span>
+
+#include <computoc/array.h>
+
+using Float_array = computoc::Array<float>;
+
+// Number of elements from 1e2 to 1e8
+#define COMPUTOC_ARRAY_SIZES RangeMultiplier(100)->Range(100, 100'000'000)
+
+static Float_array random_array(std::initializer_list<std::int64_t> dims)
+{
+    Float_array arr{ dims };
+    std::mt19937 gen{ 1998 };
+    std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+    for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+        arr.data()[i] = dist(gen);
+    }
+    return arr;
+}
+
+// Two dimensional dimensions of about count elements, with square-like shape
+static std::int64_t rows_of(std::int64_t count)
+{
+    return std::max<std::int64_t>(static_cast<std::int64_t>(std::sqrt(static_cast<double>(count))), 1);
+}
+
+static void set_processed(benchmark::State& state, std::int64_t items_per_iteration, std::int64_t bytes_per_iteration)
+{
+    state.SetItemsProcessed(state.iterations() * items_per_iteration);
+    state.SetBytesProcessed(state.iterations() * bytes_per_iteration);
+}
+
+static void BM_array_add(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array lhs{ random_array({ n }) };
+    Float_array rhs{ random_array({ n }) };
+
+    for (auto _ : state) {
+        Float_array res{ lhs + rhs };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, n, 3 * n * sizeof(float));
+}
+BENCHMARK(BM_array_add)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_add_parallel(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array lhs{ random_array({ n }) };
+    Float_array rhs{ random_array({ n }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::transform(computoc::par, lhs, rhs, std::plus<>{}) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, n, 3 * n * sizeof(float));
+}
+BENCHMARK(BM_array_add_parallel)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_chained_arithmetic(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array a{ random_array({ n }) };
+    Float_array b{ random_array({ n }) };
+    Float_array c{ random_array({ n }) };
+
+    for (auto _ : state) {
+        Float_array res{ (a + b) * c - 1.0f };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, 3 * n, 4 * n * sizeof(float));
+}
+BENCHMARK(BM_array_chained_arithmetic)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_add_scalar_inplace(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        arr += 1.0f;
+        benchmark::DoNotOptimize(arr.data());
+    }
+    set_processed(state, n, 2 * n * sizeof(float));
+}
+BENCHMARK(BM_array_add_scalar_inplace)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_unary_transform(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::transform(arr, [](float a) { return std::sqrt(a); }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, n, 2 * n * sizeof(float));
+}
+BENCHMARK(BM_array_unary_transform)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_reduce(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computoc::reduce(arr, std::plus<>{}));
+    }
+    set_processed(state, n, n * sizeof(float));
+}
+BENCHMARK(BM_array_reduce)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_reduce_along_axis(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t axis{ state.range(1) };
+    const std::int64_t rows{ rows_of(n) };
+    Float_array arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::reduce(arr, std::plus<>{}, axis) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, arr.header().count(), arr.header().count() * sizeof(float));
+}
+BENCHMARK(BM_array_reduce_along_axis)->ArgsProduct({ benchmark::CreateRange(100, 100'000'000, 100), { 0, 1 } });
+
+static void BM_array_slice_clone(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    Float_array arr{ random_array({ rows, n / rows }) };
+    Float_array slice{ arr({ {0, rows - 1, 2}, {0, n / rows - 1, 2} }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::clone(slice) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, slice.header().count(), 2 * slice.header().count() * sizeof(float));
+}
+BENCHMARK(BM_array_slice_clone)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_transpose(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    Float_array arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::transpose(arr, { 1, 0 }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, arr.header().count(), 2 * arr.header().count() * sizeof(float));
+}
+BENCHMARK(BM_array_transpose)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_sort(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Float_array res{ computoc::clone(arr) };
+        state.ResumeTiming();
+        std::sort(res.begin(), res.end());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_array_sort)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_array_sort_subarray(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    const Float_array arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Float_array res{ computoc::clone(arr) };
+        Float_array slice{ res({ {0, rows - 1}, {0, n / rows - 1, 2} }) };
+        state.ResumeTiming();
+        std::sort(slice.begin(), slice.end());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n / 2);
+}
+BENCHMARK(BM_array_sort_subarray)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+// Selection ratio in percents
+static void BM_array_filter(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const float threshold{ 1.0f - static_cast<float>(state.range(1)) / 100.0f };
+    Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::filter(arr, [threshold](float a) { return a >= threshold; }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, n, n * sizeof(float));
+}
+BENCHMARK(BM_array_filter)->ArgsProduct({ benchmark::CreateRange(100, 100'000'000, 100), { 1, 50 } });
+
+static void BM_array_find(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const float threshold{ 1.0f - static_cast<float>(state.range(1)) / 100.0f };
+    Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        computoc::Array<std::int64_t> res{ computoc::find(arr, [threshold](float a) { return a >= threshold; }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, n, n * sizeof(float));
+}
+BENCHMARK(BM_array_find)->ArgsProduct({ benchmark::CreateRange(100, 100'000'000, 100), { 1, 50 } });
+
+static void BM_array_filter_bit_mask(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const float threshold{ 1.0f - static_cast<float>(state.range(1)) / 100.0f };
+    Float_array arr{ random_array({ n }) };
+
+    for (auto _ : state) {
+        const computoc::Bit_mask<> mask{ computoc::pack(arr, [threshold](float a) { return a >= threshold; }) };
+        Float_array res{ computoc::filter(arr, mask) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, n, n * sizeof(float));
+}
+BENCHMARK(BM_array_filter_bit_mask)->ArgsProduct({ benchmark::CreateRange(100, 100'000'000, 100), { 1, 50 } });
+
+static void BM_array_any_bool_mask(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const computoc::Array<bool> mask(std::initializer_list<std::int64_t>{ n }, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computoc::any(mask));
+        benchmark::ClobberMemory();
+    }
+    set_processed(state, n, n * sizeof(bool));
+}
+BENCHMARK(BM_array_any_bool_mask)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_any_bit_mask(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const computoc::Bit_mask<> mask{ { n } };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computoc::any(mask));
+        benchmark::ClobberMemory();
+    }
+    set_processed(state, n, mask.num_words() * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_array_any_bit_mask)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_append(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array lhs{ random_array({ n }) };
+    Float_array rhs{ random_array({ n }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::append(lhs, rhs) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, 2 * n, 4 * n * sizeof(float));
+}
+BENCHMARK(BM_array_append)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+// Total number of elements in 512 shards of 16 element rows, joined by pairwise append or by a single concatenate
+static std::vector<Float_array> row_shards(std::int64_t n)
+{
+    const std::int64_t shard_rows{ std::max<std::int64_t>(n / (512 * 16), 1) };
+    std::vector<Float_array> shards;
+    for (std::int64_t i = 0; i < 512; ++i) {
+        shards.push_back(random_array({ shard_rows, 16 }));
+    }
+    return shards;
+}
+
+static void BM_array_append_shards(benchmark::State& state)
+{
+    const std::vector<Float_array> shards{ row_shards(state.range(0)) };
+
+    for (auto _ : state) {
+        Float_array res{};
+        for (const auto& shard : shards) {
+            res = computoc::append(res, shard, 0);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 512 * shards.front().header().count());
+}
+BENCHMARK(BM_array_append_shards)->Arg(10'000)->Arg(100'000);
+
+static void BM_array_concatenate_shards(benchmark::State& state)
+{
+    const std::vector<Float_array> shards{ row_shards(state.range(0)) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::concatenate(std::span<const Float_array>(shards)) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 512 * shards.front().header().count());
+}
+BENCHMARK(BM_array_concatenate_shards)->RangeMultiplier(100)->Range(10'000, 100'000'000);
+
+static void BM_array_concatenate_shards_parallel(benchmark::State& state)
+{
+    const std::vector<Float_array> shards{ row_shards(state.range(0)) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::concatenate(computoc::par, std::span<const Float_array>(shards)) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 512 * shards.front().header().count());
+}
+BENCHMARK(BM_array_concatenate_shards_parallel)->RangeMultiplier(100)->Range(10'000, 100'000'000);
+
+// Number of appended rows of 16 elements
+static void BM_array_push_back_rows(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    Float_array row{ random_array({ 16 }) };
+
+    for (auto _ : state) {
+        Float_array arr{};
+        for (std::int64_t i = 0; i < n; ++i) {
+            arr.push_back(row);
+        }
+        benchmark::DoNotOptimize(arr.data());
+    }
+    set_processed(state, n, n * row.header().count() * sizeof(float));
+}
+BENCHMARK(BM_array_push_back_rows)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_array_reshape(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    Float_array arr{ random_array({ rows * (n / rows) }) };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::reshape(arr, { rows, n / rows }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * arr.header().count());
+}
+BENCHMARK(BM_array_reshape)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_reshape_subarray(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    Float_array arr{ random_array({ rows, n / rows }) };
+    Float_array slice{ arr({ {0, rows - 1, 2} }) };
+    const std::int64_t slice_count{ slice.header().count() };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::reshape(slice, { slice_count }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    set_processed(state, slice_count, 2 * slice_count * sizeof(float));
+}
+BENCHMARK(BM_array_reshape_subarray)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_reshape_rows_subarray(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    Float_array arr{ random_array({ rows, n / rows }) };
+    Float_array block{ arr({ {0, rows / 2 - 1} }) };
+    const std::int64_t block_count{ block.header().count() };
+
+    for (auto _ : state) {
+        Float_array res{ computoc::reshape(block, { block_count }) };
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * block_count);
+}
+BENCHMARK(BM_array_reshape_rows_subarray)->COMPUTOC_ARRAY_SIZES;
+
+static void BM_array_subscripts_access(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    const Float_array arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        float sum{ 0.0f };
+        for (std::int64_t i = 0; i < rows; ++i) {
+            for (std::int64_t j = 0; j < n / rows; ++j) {
+                sum += arr({ i, j });
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * arr.header().count());
+}
+BENCHMARK(BM_array_subscripts_access)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_array_unchecked_subscripts_access(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    const Float_array arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        float sum{ 0.0f };
+        for (std::int64_t i = 0; i < rows; ++i) {
+            for (std::int64_t j = 0; j < n / rows; ++j) {
+                sum += arr.at_unchecked({ i, j });
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * arr.header().count());
+}
+BENCHMARK(BM_array_unchecked_subscripts_access)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_fixed_rank_array_subscripts_access(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    const computoc::Fixed_rank_array<float, 2> arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        float sum{ 0.0f };
+        for (std::int64_t i = 0; i < rows; ++i) {
+            for (std::int64_t j = 0; j < n / rows; ++j) {
+                sum += arr(i, j);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * arr.count());
+}
+BENCHMARK(BM_fixed_rank_array_subscripts_access)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_fixed_rank_array_unchecked_subscripts_access(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    const computoc::Fixed_rank_array<float, 2> arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        float sum{ 0.0f };
+        for (std::int64_t i = 0; i < rows; ++i) {
+            for (std::int64_t j = 0; j < n / rows; ++j) {
+                sum += arr.at_unchecked(i, j);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * arr.count());
+}
+BENCHMARK(BM_fixed_rank_array_unchecked_subscripts_access)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_fixed_rank_array_for_each(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    const std::int64_t rows{ rows_of(n) };
+    const computoc::Fixed_rank_array<float, 2> arr{ random_array({ rows, n / rows }) };
+
+    for (auto _ : state) {
+        float sum{ 0.0f };
+        arr.for_each([&sum](float value) { sum += value; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * arr.count());
+}
+BENCHMARK(BM_fixed_rank_array_for_each)->COMPUTOC_ARRAY_SIZES;
+
+#undef COMPUTOC_ARRAY_SIZES
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <random>
+
+#include <computoc/complex.h>
+
+using Double_complex = computoc::Complex<double>;
+
+static std::vector<Double_complex> random_complexes(std::int64_t n, unsigned seed)
+{
+    std::vector<Double_complex> v(n);
+    std::mt19937 gen{ seed };
+    std::uniform_real_distribution<double> dist{ -1.0, 1.0 };
+    for (auto& c : v) {
+        c = Double_complex{ dist(gen), dist(gen) };
+    }
+    return v;
+}
+
+static void BM_complex_multiply_add(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    std::vector<Double_complex> a{ random_complexes(n, 1) };
+    std::vector<Double_complex> b{ random_complexes(n, 2) };
+    std::vector<Double_complex> res(n);
+
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < n; ++i) {
+            res[i] = a[i] * b[i] + a[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_complex_multiply_add)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_complex_divide(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    std::vector<Double_complex> a{ random_complexes(n, 1) };
+    std::vector<Double_complex> b{ random_complexes(n, 2) };
+    std::vector<Double_complex> res(n);
+
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < n; ++i) {
+            res[i] = a[i] / b[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_complex_divide)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_complex_exp(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    std::vector<Double_complex> a{ random_complexes(n, 1) };
+    std::vector<Double_complex> res(n);
+
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < n; ++i) {
+            res[i] = computoc::exp(a[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_complex_exp)->RangeMultiplier(100)->Range(100, 1'000'000);
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include <computoc/derivatives.h>
+
+using Node_ptr = std::shared_ptr<computoc::Node<double>>;
+
+// Balanced expression tree of the given depth, alternating additions and multiplications
+// over the variables x (id 0) and y (id 1)
+static Node_ptr expression_tree(std::int64_t depth, const Node_ptr& x, const Node_ptr& y)
+{
+    if (depth == 0) {
+        return computoc::sin(computoc::add(x, computoc::multiply(y, computoc::constant(0.5))));
+    }
+    Node_ptr lhs{ expression_tree(depth - 1, x, y) };
+    Node_ptr rhs{ expression_tree(depth - 1, y, x) };
+    return depth % 2 == 0 ? computoc::add(lhs, rhs) : computoc::multiply(lhs, rhs);
+}
+
+static void BM_derivatives_compute(benchmark::State& state)
+{
+    Node_ptr x{ computoc::variable(0, 0.25) };
+    Node_ptr y{ computoc::variable(1, 0.75) };
+    Node_ptr f{ expression_tree(state.range(0), x, y) };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f->compute());
+    }
+    state.SetItemsProcessed(state.iterations() * (std::int64_t{ 1 } << state.range(0)));
+}
+BENCHMARK(BM_derivatives_compute)->DenseRange(2, 12, 2);
+
+static void BM_derivatives_backward(benchmark::State& state)
+{
+    Node_ptr x{ computoc::variable(0, 0.25) };
+    Node_ptr y{ computoc::variable(1, 0.75) };
+    Node_ptr f{ expression_tree(state.range(0), x, y) };
+
+    for (auto _ : state) {
+        Node_ptr df{ f->backward(0) };
+        benchmark::DoNotOptimize(df.get());
+    }
+    state.SetItemsProcessed(state.iterations() * (std::int64_t{ 1 } << state.range(0)));
+}
+BENCHMARK(BM_derivatives_backward)->DenseRange(2, 12, 2);
+
+static void BM_derivatives_backward_compute(benchmark::State& state)
+{
+    Node_ptr x{ computoc::variable(0, 0.25) };
+    Node_ptr y{ computoc::variable(1, 0.75) };
+    Node_ptr f{ expression_tree(state.range(0), x, y) };
+    Node_ptr df{ f->backward(0) };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(df->compute());
+    }
+    state.SetItemsProcessed(state.iterations() * (std::int64_t{ 1 } << state.range(0)));
+}
+BENCHMARK(BM_derivatives_backward_compute)->DenseRange(2, 12, 2);
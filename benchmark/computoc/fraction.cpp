@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <random>
+
+#include <computoc/fraction.h>
+
+using Integer_fraction = computoc::Fraction<int>;
+
+// Small numerators and denominators keep the results from overflowing
+static std::vector<Integer_fraction> random_fractions(std::int64_t n, unsigned seed)
+{
+    std::vector<Integer_fraction> v(n);
+    std::mt19937 gen{ seed };
+    std::uniform_int_distribution<int> num_dist{ -100, 100 };
+    std::uniform_int_distribution<int> den_dist{ 1, 100 };
+    for (auto& f : v) {
+        f = Integer_fraction{ num_dist(gen), den_dist(gen) };
+    }
+    return v;
+}
+
+static void BM_fraction_add(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    std::vector<Integer_fraction> a{ random_fractions(n, 1) };
+    std::vector<Integer_fraction> b{ random_fractions(n, 2) };
+    std::vector<Integer_fraction> res(n);
+
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < n; ++i) {
+            res[i] = a[i] + b[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_fraction_add)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_fraction_multiply(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    std::vector<Integer_fraction> a{ random_fractions(n, 1) };
+    std::vector<Integer_fraction> b{ random_fractions(n, 2) };
+    std::vector<Integer_fraction> res(n);
+
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < n; ++i) {
+            res[i] = a[i] * b[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_fraction_multiply)->RangeMultiplier(100)->Range(100, 1'000'000);
+
+static void BM_fraction_compare(benchmark::State& state)
+{
+    const std::int64_t n{ state.range(0) };
+    std::vector<Integer_fraction> a{ random_fractions(n, 1) };
+    std::vector<Integer_fraction> b{ random_fractions(n, 2) };
+
+    for (auto _ : state) {
+        std::int64_t less_count{ 0 };
+        for (std::int64_t i = 0; i < n; ++i) {
+            less_count += a[i] < b[i] ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(less_count);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_fraction_compare)->RangeMultiplier(100)->Range(100, 1'000'000);
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+
+#include <computoc/linear_algebra.h>
+#include <computoc/matrix.h>
+
+using Double_matrix = computoc::Matrix<double>;
+
+static Double_matrix random_matrix(std::size_t n)
+{
+    Double_matrix mat{ {n, n, 1} };
+    std::mt19937 gen{ 1998 };
+    std::uniform_real_distribution<double> dist{ -1.0, 1.0 };
+    for (std::size_t i = 0; i < n * n; ++i) {
+        mat.data()[i] = dist(gen);
+    }
+    return mat;
+}
+
+static void BM_matrix_multiply(benchmark::State& state)
+{
+    const std::size_t n{ static_cast<std::size_t>(state.range(0)) };
+    Double_matrix lhs{ random_matrix(n) };
+    Double_matrix rhs{ random_matrix(n) };
+
+    for (auto _ : state) {
+        Double_matrix res{ lhs * rhs };
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+BENCHMARK(BM_matrix_multiply)->RangeMultiplier(4)->Range(4, 256);
+
+// Determinant is computed by cofactor expansion, hence the small sizes
+static void BM_matrix_determinant(benchmark::State& state)
+{
+    const std::size_t n{ static_cast<std::size_t>(state.range(0)) };
+    Double_matrix mat{ random_matrix(n) };
+
+    for (auto _ : state) {
+        Double_matrix res{ computoc::determinant(mat) };
+        benchmark::DoNotOptimize(res.data());
+    }
+}
+BENCHMARK(BM_matrix_determinant)->DenseRange(2, 8);
+
+static void BM_matrix_inverse(benchmark::State& state)
+{
+    const std::size_t n{ static_cast<std::size_t>(state.range(0)) };
+    Double_matrix mat{ random_matrix(n) };
+
+    for (auto _ : state) {
+        Double_matrix res{ computoc::inversed(mat) };
+        benchmark::DoNotOptimize(res.data());
+    }
+}
+BENCHMARK(BM_matrix_inverse)->DenseRange(2, 7);
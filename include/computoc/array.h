@@ -3,15 +3,58 @@
 
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <initializer_list>
 #include <stdexcept>
 #include <span>
+#include <array>
+#include <concepts>
+#include <compare>
+#include <iterator>
 #include <limits>
 #include <algorithm>
 #include <numeric>
 #include <variant>
 #include <sstream>
 #include <cmath>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <optional>
+#include <latch>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <bit>
+
+#include <memoc/allocators.h>
+#include <memoc/blocks.h>
+
+#if !defined(COMPUTOC_DISABLE_SIMD)
+#if defined(__AVX512F__)
+#define COMPUTOC_SIMD_AVX512
+#elif defined(__AVX2__)
+#define COMPUTOC_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COMPUTOC_SIMD_SSE2
+#endif
+#endif
+
+#if defined(COMPUTOC_SIMD_AVX512) || defined(COMPUTOC_SIMD_AVX2) || defined(COMPUTOC_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace computoc {
     namespace details {
@@ -428,12 +471,25 @@ namespace computoc {
 
     namespace details {
 
+        // array buffers are aligned to a cache line, which also allows aligned SIMD loads and stores
+        inline constexpr std::size_t default_data_alignment = 64;
+
+        /**
+        * @note Selects the allocation functions of element buffers, which are aligned to default_data_alignment.
+        * Other allocations (dimensions, strides, shared control blocks) keep the natural alignment of their type.
+        */
+        struct Data_buffer_tag {};
+        inline constexpr Data_buffer_tag data_buffer{};
+
         template <typename T>
         requires (!std::is_reference_v<T>)
         class Lightweight_stl_allocator {
         public:
             using value_type = T;
 
+            static constexpr std::size_t alignment = alignof(T);
+            static constexpr std::size_t data_buffer_alignment = std::max(alignof(T), default_data_alignment);
+
             constexpr Lightweight_stl_allocator() = default;
             constexpr Lightweight_stl_allocator(const Lightweight_stl_allocator& other) = default;
             constexpr Lightweight_stl_allocator& operator=(const Lightweight_stl_allocator& other) = default;
@@ -447,17 +503,229 @@ namespace computoc {
 
             [[nodiscard]] constexpr T* allocate(std::size_t n)
             {
-                return n == 0 ? nullptr : reinterpret_cast<T*>(operator new[](n * sizeof(T)));
+                return n == 0 ? nullptr : reinterpret_cast<T*>(operator new[](n * sizeof(T), std::align_val_t{ alignment }));
+            }
+            [[nodiscard]] constexpr T* allocate(std::size_t n, Data_buffer_tag)
+            {
+                return n == 0 ? nullptr : reinterpret_cast<T*>(operator new[](n * sizeof(T), std::align_val_t{ data_buffer_alignment }));
             }
 
             constexpr void deallocate(T* p, std::size_t n) noexcept
             {
                 if (p && n > 0) {
-                    operator delete[](p, n * sizeof(T));
+                    operator delete[](p, n * sizeof(T), std::align_val_t{ alignment });
+                }
+            }
+            constexpr void deallocate(T* p, std::size_t n, Data_buffer_tag) noexcept
+            {
+                if (p && n > 0) {
+                    operator delete[](p, n * sizeof(T), std::align_val_t{ data_buffer_alignment });
+                }
+            }
+        };
+
+        /**
+        * @note A bump region for short-lived arrays. While a scope is alive, every allocation made through
+        * Arena_allocator on the same thread is carved from the scope chunks, and all of them are released
+        * at once when the scope ends. Memory allocated inside a scope must not outlive it.
+        * Chunks are taken from a per-thread memoc::Free_list_allocator, so consecutive scopes reuse them
+        * without going back to the heap.
+        */
+        class Arena_scope final {
+        public:
+            static constexpr std::int64_t chunk_size = std::int64_t{ 1 } << 20;
+            // the largest alignment of the allocations
+            static constexpr std::int64_t alignment = static_cast<std::int64_t>(default_data_alignment);
+
+            Arena_scope() noexcept
+                : prev_(current_)
+            {
+                current_ = this;
+            }
+
+            Arena_scope(const Arena_scope&) = delete;
+            Arena_scope& operator=(const Arena_scope&) = delete;
+            Arena_scope(Arena_scope&&) = delete;
+            Arena_scope& operator=(Arena_scope&&) = delete;
+
+            ~Arena_scope() noexcept
+            {
+                while (chunks_) {
+                    Chunk* c = chunks_;
+                    chunks_ = c->prev;
+                    memoc::Block<void> b(c->size, c, c->hint);
+                    chunks_allocator_.deallocate(b);
+                }
+                current_ = prev_;
+            }
+
+            [[nodiscard]] static Arena_scope* current() noexcept
+            {
+                return current_;
+            }
+
+            [[nodiscard]] void* allocate(std::int64_t n, std::int64_t align = alignment) noexcept
+            {
+                std::uint8_t* p = align_up(ptr_, align);
+                if (!chunks_ || end_ - p < n) {
+                    if (!add_chunk(n)) {
+                        return nullptr;
+                    }
+                    p = align_up(ptr_, align);
+                }
+                ptr_ = p + n;
+                return p;
+            }
+
+            // only the most recent allocation is reclaimed, the rest is released with the scope
+            void deallocate(void* p, std::int64_t n) noexcept
+            {
+                if (reinterpret_cast<std::uint8_t*>(p) + n == ptr_) {
+                    ptr_ = reinterpret_cast<std::uint8_t*>(p);
+                }
+            }
+
+            [[nodiscard]] bool owns(const void* p) const noexcept
+            {
+                const std::uint8_t* lp = reinterpret_cast<const std::uint8_t*>(p);
+                for (const Chunk* c = chunks_; c; c = c->prev) {
+                    const std::uint8_t* begin = reinterpret_cast<const std::uint8_t*>(c);
+                    if (lp >= begin && lp < begin + c->size) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /**
+            * @note Returns the memory to the innermost scope of the calling thread that owns it.
+            * @return false if no active scope owns p.
+            */
+            static bool release(void* p, std::int64_t n) noexcept
+            {
+                for (Arena_scope* s = current_; s; s = s->prev_) {
+                    if (s->owns(p)) {
+                        s->deallocate(p, n);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            struct Chunk {
+                Chunk* prev{ nullptr };
+                std::int64_t size{ 0 };
+                std::int64_t hint{ 0 };
+            };
+
+            static constexpr std::int64_t header_size = ((static_cast<std::int64_t>(sizeof(Chunk)) + alignment - 1) / alignment) * alignment;
+
+            [[nodiscard]] static std::uint8_t* align_up(std::uint8_t* p, std::int64_t align) noexcept
+            {
+                std::uintptr_t a = reinterpret_cast<std::uintptr_t>(p);
+                return reinterpret_cast<std::uint8_t*>((a + align - 1) & ~static_cast<std::uintptr_t>(align - 1));
+            }
+
+            [[nodiscard]] bool add_chunk(std::int64_t n) noexcept
+            {
+                std::int64_t size = std::max(chunk_size, header_size + n + alignment);
+                erroc::Expected<memoc::Block<void>, memoc::Allocator_error> r = chunks_allocator_.allocate(size);
+                if (!r || r.value().empty()) {
+                    return false;
+                }
+                Chunk* c = ::new (r.value().data()) Chunk{ chunks_, size, r.value().hint() };
+                chunks_ = c;
+                ptr_ = reinterpret_cast<std::uint8_t*>(c) + header_size;
+                end_ = reinterpret_cast<std::uint8_t*>(c) + size;
+                return true;
+            }
+
+            using Chunks_allocator = memoc::Free_list_allocator<memoc::Malloc_allocator, chunk_size, chunk_size, 16>;
+
+            inline static thread_local Arena_scope* current_{ nullptr };
+            inline static thread_local Chunks_allocator chunks_allocator_{};
+
+            Arena_scope* prev_{ nullptr };
+            Chunk* chunks_{ nullptr };
+            std::uint8_t* ptr_{ nullptr };
+            std::uint8_t* end_{ nullptr };
+        };
+
+        /**
+        * @note Allocates from the innermost Arena_scope of the calling thread, or from the heap when no scope
+        * is active. Can be used for both the Data_allocator and the Internals_allocator of an Array.
+        */
+        template <typename T>
+        requires (!std::is_reference_v<T>)
+        class Arena_allocator {
+        public:
+            using value_type = T;
+
+            static constexpr std::size_t alignment = alignof(T);
+            static constexpr std::size_t data_buffer_alignment = std::max(alignof(T), default_data_alignment);
+
+            constexpr Arena_allocator() = default;
+            constexpr Arena_allocator(const Arena_allocator& other) = default;
+            constexpr Arena_allocator& operator=(const Arena_allocator& other) = default;
+            constexpr Arena_allocator(Arena_allocator&& other) = default;
+            constexpr Arena_allocator& operator=(Arena_allocator&& other) = default;
+            constexpr ~Arena_allocator() = default;
+
+            template <typename U>
+            requires (!std::is_reference_v<U>)
+                constexpr Arena_allocator(const Arena_allocator<U>&) noexcept {}
+
+            [[nodiscard]] T* allocate(std::size_t n)
+            {
+                return allocate_aligned(n, alignment);
+            }
+            [[nodiscard]] T* allocate(std::size_t n, Data_buffer_tag)
+            {
+                return allocate_aligned(n, data_buffer_alignment);
+            }
+
+            void deallocate(T* p, std::size_t n) noexcept
+            {
+                deallocate_aligned(p, n, alignment);
+            }
+            void deallocate(T* p, std::size_t n, Data_buffer_tag) noexcept
+            {
+                deallocate_aligned(p, n, data_buffer_alignment);
+            }
+
+        private:
+            [[nodiscard]] static T* allocate_aligned(std::size_t n, std::size_t align)
+            {
+                if (n == 0) {
+                    return nullptr;
+                }
+                if (Arena_scope* s = Arena_scope::current(); s && static_cast<std::int64_t>(align) <= Arena_scope::alignment) {
+                    if (void* p = s->allocate(static_cast<std::int64_t>(n * sizeof(T)), static_cast<std::int64_t>(align))) {
+                        return reinterpret_cast<T*>(p);
+                    }
+                }
+                return reinterpret_cast<T*>(operator new[](n * sizeof(T), std::align_val_t{ align }));
+            }
+
+            static void deallocate_aligned(T* p, std::size_t n, std::size_t align) noexcept
+            {
+                if (!p || n == 0) {
+                    return;
                 }
+                if (Arena_scope::release(p, static_cast<std::int64_t>(n * sizeof(T)))) {
+                    return;
+                }
+                operator delete[](p, n * sizeof(T), std::align_val_t{ align });
             }
         };
 
+        /**
+        * @note Selects the constructors of buffers whose elements are all written before being read.
+        */
+        struct Uninitialized_tag {};
+        inline constexpr Uninitialized_tag uninitialized{};
+
         template <typename T, template<typename> typename Allocator = Lightweight_stl_allocator>
         requires (std::is_copy_constructible_v<T>&& std::is_copy_assignable_v<T>)
             class simple_dynamic_vector final {
@@ -470,11 +738,12 @@ namespace computoc {
                 using const_pointer = const T*;
 
                 using capacity_func_type = std::function<size_type(size_type)>;
+                using release_func_type = std::function<void(pointer, size_type)>;
 
                 constexpr simple_dynamic_vector(size_type size = 0, const_pointer data = nullptr, capacity_func_type capacity_func = [](size_type s) { return static_cast<size_type>(1.5 * s); })
                     : size_(size), capacity_(size), capacity_func_(capacity_func)
                 {
-                    data_ptr_ = alloc_.allocate(capacity_);
+                    data_ptr_ = allocate_storage(capacity_);
                     if (data) {
                         std::uninitialized_copy_n(data, size_, data_ptr_);
                     }
@@ -483,53 +752,94 @@ namespace computoc {
                     }
                 }
 
+                /**
+                * @note Elements of trivially copyable and destructible types are left uninitialized, to be assigned by the caller.
+                */
+                constexpr simple_dynamic_vector(size_type size, Uninitialized_tag)
+                    : size_(size), capacity_(size), capacity_func_([](size_type s) { return static_cast<size_type>(1.5 * s); })
+                {
+                    data_ptr_ = allocate_storage(capacity_);
+                    if constexpr (!(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>)) {
+                        std::uninitialized_default_construct_n(data_ptr_, size_);
+                    }
+                }
+
+                /**
+                * @note The vector uses the external data as its storage, without copying it, and calls release_func with it
+                * instead of deallocating it. Growing the vector moves the elements to an allocated storage.
+                */
+                simple_dynamic_vector(pointer external_data, size_type size, release_func_type release_func)
+                    : data_ptr_(external_data), size_(size), capacity_(size), capacity_func_([](size_type s) { return static_cast<size_type>(1.5 * s); }), release_func_(std::move(release_func))
+                {
+                }
+
+                /**
+                * @note The vector views the elements of source until either of them is detached. Detaching the viewing vector
+                * copies the elements to an allocated storage, or takes over the storage of source if no array owns it anymore.
+                * Detaching source hands its current storage over to the vectors viewing it, and copies the elements for itself.
+                * Resizing either vector detaches it.
+                */
+                explicit simple_dynamic_vector(const std::shared_ptr<simple_dynamic_vector>& source)
+                    : data_ptr_(nullptr), size_(0), capacity_(0), capacity_func_([](size_type s) { return static_cast<size_type>(1.5 * s); }), source_(source->viewers_.lock())
+                {
+                    if (!source_) {
+                        source_ = std::allocate_shared<std::shared_ptr<simple_dynamic_vector>>(Allocator<std::shared_ptr<simple_dynamic_vector>>(), source);
+                        source->viewers_ = source_;
+                    }
+                }
+
                 template <typename InputIt>
                 constexpr simple_dynamic_vector(InputIt first, InputIt last)
                 {
                     size_ = capacity_ = last - first;
-                    data_ptr_ = alloc_.allocate(capacity_);
+                    data_ptr_ = allocate_storage(capacity_);
                     std::uninitialized_copy_n(first, size_, data_ptr_);
                 }
 
                 constexpr simple_dynamic_vector(const simple_dynamic_vector& other)
-                    : alloc_(other.alloc_), size_(other.size_), capacity_(other.capacity_), capacity_func_(other.capacity_func_)
+                    : alloc_(other.alloc_), size_(other.size()), capacity_(other.capacity()), capacity_func_(other.capacity_func_)
                 {
-                    data_ptr_ = alloc_.allocate(capacity_);
-                    std::uninitialized_copy_n(other.data_ptr_, other.size_, data_ptr_);
+                    data_ptr_ = allocate_storage(capacity_);
+                    std::uninitialized_copy_n(other.data(), size_, data_ptr_);
                 }
 
-                constexpr simple_dynamic_vector operator=(const simple_dynamic_vector& other)
+                constexpr simple_dynamic_vector& operator=(const simple_dynamic_vector& other)
                 {
                     if (this == &other) {
                         return *this;
                     }
 
+                    // vectors viewing this one keep its current elements
+                    detach();
+
                     if constexpr (!std::is_fundamental_v<T>) {
                         std::destroy_n(data_ptr_, size_);
                     }
-                    alloc_.deallocate(data_ptr_, capacity_);
+                    deallocate_data();
 
                     alloc_ = other.alloc_;
-                    size_ = other.size_;
-                    capacity_ = other.capacity_;
+                    size_ = other.size();
+                    capacity_ = other.capacity();
                     capacity_func_ = other.capacity_func_;
 
-                    data_ptr_ = alloc_.allocate(capacity_);
-                    std::uninitialized_copy_n(other.data_ptr_, other.size_, data_ptr_);
+                    data_ptr_ = allocate_storage(capacity_);
+                    std::uninitialized_copy_n(other.data(), size_, data_ptr_);
 
                     return *this;
                 }
 
                 constexpr simple_dynamic_vector(simple_dynamic_vector&& other) noexcept
-                    : alloc_(std::move(other.alloc_)), size_(other.size_), capacity_(other.capacity_), capacity_func_(std::move(other.capacity_func_))
+                    : alloc_(std::move(other.alloc_)), size_(other.size_), capacity_(other.capacity_), capacity_func_(std::move(other.capacity_func_)), release_func_(std::move(other.release_func_)), source_(std::move(other.source_))
                 {
                     data_ptr_ = other.data_ptr_;
 
+                    other.release_func_ = nullptr;
+
                     other.data_ptr_ = nullptr;
                     other.size_ = 0;
                 }
 
-                constexpr simple_dynamic_vector operator=(simple_dynamic_vector&& other) noexcept
+                constexpr simple_dynamic_vector& operator=(simple_dynamic_vector&& other) noexcept
                 {
                     if (this == &other) {
                         return *this;
@@ -538,15 +848,19 @@ namespace computoc {
                     if constexpr (!std::is_fundamental_v<T>) {
                         std::destroy_n(data_ptr_, size_);
                     }
-                    alloc_.deallocate(data_ptr_, capacity_);
+                    deallocate_data();
 
                     alloc_ = std::move(other.alloc_);
                     size_ = other.size_;
                     capacity_ = other.capacity_;
                     capacity_func_ = std::move(other.capacity_func_);
+                    release_func_ = std::move(other.release_func_);
+                    source_ = std::move(other.source_);
 
                     data_ptr_ = other.data_ptr_;
 
+                    other.release_func_ = nullptr;
+
                     other.data_ptr_ = nullptr;
                     other.size_ = 0;
 
@@ -558,41 +872,110 @@ namespace computoc {
                     if constexpr (!std::is_fundamental_v<T>) {
                         std::destroy_n(data_ptr_, size_);
                     }
-                    alloc_.deallocate(data_ptr_, capacity_);
+                    deallocate_data();
                 }
 
                 [[nodiscard]] constexpr bool empty() const noexcept
                 {
-                    return size_ == 0 || !data_ptr_;
+                    return size() == 0 || !data();
                 }
 
                 [[nodiscard]] constexpr size_type size() const noexcept
                 {
-                    return size_;
+                    return source_ ? (*source_)->size() : size_;
                 }
 
                 [[nodiscard]] constexpr size_type capacity() const noexcept
                 {
-                    return capacity_;
+                    return source_ ? (*source_)->capacity() : capacity_;
+                }
+
+                /**
+                * @note Returns true if the vector uses external data as its storage.
+                */
+                [[nodiscard]] constexpr bool is_external() const noexcept
+                {
+                    return source_ ? (*source_)->is_external() : static_cast<bool>(release_func_);
+                }
+
+                /**
+                * @note Returns true if the vector views the elements of another vector.
+                */
+                [[nodiscard]] constexpr bool is_copy_on_write() const noexcept
+                {
+                    return static_cast<bool>(source_);
+                }
+
+                /**
+                * @note Returns true if other vectors view the elements of the vector.
+                */
+                [[nodiscard]] bool is_viewed() const noexcept
+                {
+                    return !viewers_.expired();
+                }
+
+                /**
+                * @note Gives the vector elements of its own, which are not viewed by other vectors.
+                */
+                constexpr void detach()
+                {
+                    if (std::shared_ptr<std::shared_ptr<simple_dynamic_vector>> viewers{ viewers_.lock() }) {
+                        viewers_.reset();
+                        *viewers = std::allocate_shared<simple_dynamic_vector>(Allocator<simple_dynamic_vector>(), std::move(*this));
+
+                        const simple_dynamic_vector& handed_over{ **viewers };
+                        capacity_func_ = handed_over.capacity_func_;
+                        size_ = capacity_ = handed_over.size();
+                        data_ptr_ = allocate_storage(capacity_);
+                        std::uninitialized_copy_n(handed_over.data(), size_, data_ptr_);
+                        return;
+                    }
+
+                    if (!source_) {
+                        return;
+                    }
+
+                    std::shared_ptr<std::shared_ptr<simple_dynamic_vector>> source{ std::move(source_) };
+                    if (source.use_count() == 1 && source->use_count() == 1) {
+                        *this = std::move(**source);
+                        // the taken over vector may itself view another vector
+                        detach();
+                        return;
+                    }
+
+                    size_ = capacity_ = (*source)->size();
+                    data_ptr_ = allocate_storage(capacity_);
+                    std::uninitialized_copy_n((*source)->data(), size_, data_ptr_);
+                }
+
+                /**
+                * @note Returns the release function of the external data if it is of type Func, or nullptr otherwise.
+                */
+                template <typename Func>
+                [[nodiscard]] const Func* release_target() const noexcept
+                {
+                    return source_ ? (*source_)->template release_target<Func>() : release_func_.template target<Func>();
                 }
 
                 [[nodiscard]] constexpr pointer data() const noexcept
                 {
-                    return data_ptr_;
+                    return source_ ? (*source_)->data() : data_ptr_;
                 }
 
                 [[nodiscard]] constexpr reference operator[](size_type index) noexcept
                 {
-                    return data_ptr_[index];
+                    return data()[index];
                 }
 
                 [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
                 {
-                    return data_ptr_[index];
+                    return data()[index];
                 }
 
                 constexpr void resize(size_type new_size)
                 {
+                    detach();
+
                     if (new_size < size_) {
                         if constexpr (!std::is_fundamental_v<T>) {
                             std::destroy_n(data_ptr_ + new_size, size_ - new_size);
@@ -602,14 +985,14 @@ namespace computoc {
                     //else if (new_size == size_) { /* do nothing */ }
                     else if (new_size > size_) {
                         size_type new_capacity = new_size;
-                        pointer new_data_ptr = alloc_.allocate(new_capacity);
+                        pointer new_data_ptr = allocate_storage(new_capacity);
                         std::uninitialized_move_n(data_ptr_, size_, new_data_ptr);
                         std::uninitialized_default_construct_n(new_data_ptr + size_, new_size - size_);
 
                         if constexpr (!std::is_fundamental_v<T>) {
                             std::destroy_n(data_ptr_, size_);
                         }
-                        alloc_.deallocate(data_ptr_, capacity_);
+                        deallocate_data();
 
                         data_ptr_ = new_data_ptr;
                         size_ = new_size;
@@ -619,12 +1002,14 @@ namespace computoc {
 
                 constexpr void reserve(size_type new_capacity)
                 {
+                    detach();
+
                     // if (new_capacity <= capacity_) do nothing
                     if (new_capacity > capacity_) {
-                        pointer new_data_ptr = alloc_.allocate(new_capacity);
+                        pointer new_data_ptr = allocate_storage(new_capacity);
                         std::uninitialized_move_n(data_ptr_, size_, new_data_ptr);
 
-                        alloc_.deallocate(data_ptr_, capacity_);
+                        deallocate_data();
                         data_ptr_ = new_data_ptr;
                         capacity_ = new_capacity;
                     }
@@ -632,6 +1017,8 @@ namespace computoc {
 
                 constexpr void expand(size_type count)
                 {
+                    detach();
+
                     if (size_ + count < capacity_) {
                         if constexpr (!std::is_fundamental_v<T>) {
                             std::uninitialized_default_construct_n(data_ptr_ + size_, count);
@@ -641,11 +1028,11 @@ namespace computoc {
                     else if (size_ + count >= capacity_) {
                         size_type new_capacity = capacity_func_(size_ + count);
                         size_type new_size = size_ + count;
-                        pointer data_ptr = alloc_.allocate(new_capacity);
+                        pointer data_ptr = allocate_storage(new_capacity);
                         std::uninitialized_move_n(data_ptr_, size_, data_ptr);
                         std::uninitialized_default_construct_n(data_ptr + size_, count);
 
-                        alloc_.deallocate(data_ptr_, capacity_);
+                        deallocate_data();
                         data_ptr_ = data_ptr;
                         capacity_ = new_capacity;
                         size_ = new_size;
@@ -654,6 +1041,8 @@ namespace computoc {
 
                 constexpr void shrink(size_type count)
                 {
+                    detach();
+
                     if (count > size_) {
                         throw std::length_error("count > size_");
                     }
@@ -666,11 +1055,13 @@ namespace computoc {
 
                 constexpr void shrink_to_fit()
                 {
+                    detach();
+
                     if (capacity_ > size_) {
-                        pointer data_ptr = alloc_.allocate(size_);
+                        pointer data_ptr = allocate_storage(size_);
                         std::uninitialized_move_n(data_ptr_, size_, data_ptr);
 
-                        alloc_.deallocate(data_ptr_, capacity_);
+                        deallocate_data();
                         data_ptr_ = data_ptr;
                         capacity_ = size_;
                     }
@@ -678,35 +1069,67 @@ namespace computoc {
 
                 [[nodiscard]] constexpr pointer begin() noexcept
                 {
-                    return data_ptr_;
+                    return data();
                 }
 
                 [[nodiscard]] constexpr pointer end() noexcept
                 {
-                    return data_ptr_ + size_;
+                    return data() + size();
                 }
 
                 [[nodiscard]] constexpr const T& back() const noexcept
                 {
-                    return data_ptr_[size_-1];
+                    return data()[size() - 1];
                 }
 
                 [[nodiscard]] constexpr T& back() noexcept
                 {
-                    return data_ptr_[size_-1];
+                    return data()[size() - 1];
                 }
 
                 [[nodiscard]] constexpr const T& front() const noexcept
                 {
-                    return data_ptr_[0];
+                    return data()[0];
                 }
 
                 [[nodiscard]] constexpr T& front() noexcept
                 {
-                    return data_ptr_[0];
+                    return data()[0];
                 }
 
             private:
+                // element buffers are over-aligned by allocators that support it
+                [[nodiscard]] constexpr pointer allocate_storage(size_type n)
+                {
+                    if constexpr (requires(Allocator<T>& a) { a.allocate(std::size_t{}, data_buffer); }) {
+                        return alloc_.allocate(n, data_buffer);
+                    }
+                    else {
+                        return alloc_.allocate(n);
+                    }
+                }
+
+                constexpr void deallocate_storage(pointer p, size_type n) noexcept
+                {
+                    if constexpr (requires(Allocator<T>& a) { a.deallocate(p, std::size_t{}, data_buffer); }) {
+                        alloc_.deallocate(p, n, data_buffer);
+                    }
+                    else {
+                        alloc_.deallocate(p, n);
+                    }
+                }
+
+                constexpr void deallocate_data() noexcept
+                {
+                    if (release_func_) {
+                        release_func_(data_ptr_, capacity_);
+                        release_func_ = nullptr;
+                    }
+                    else {
+                        deallocate_storage(data_ptr_, capacity_);
+                    }
+                }
+
                 pointer data_ptr_;
 
                 size_type size_;
@@ -715,6 +1138,12 @@ namespace computoc {
                 Allocator<T> alloc_;
 
                 capacity_func_type capacity_func_;
+                release_func_type release_func_{};
+
+                // the vector viewed by this one, replaced by the storage it hands over when it is detached
+                std::shared_ptr<std::shared_ptr<simple_dynamic_vector>> source_{};
+                // shared by the vectors viewing this one
+                std::weak_ptr<std::shared_ptr<simple_dynamic_vector>> viewers_{};
         };
 
 
@@ -741,6 +1170,11 @@ namespace computoc {
                     }
                 }
 
+                constexpr simple_static_vector(size_type size, Uninitialized_tag)
+                    : simple_static_vector(size)
+                {
+                }
+
                 template <typename InputIt>
                 constexpr simple_static_vector(InputIt first, InputIt last)
                     : simple_static_vector(last - first, &(*first)) {}
@@ -751,7 +1185,7 @@ namespace computoc {
                     std::copy(other.data_ptr_, other.data_ptr_ + other.size_, data_ptr_);
                 }
 
-                constexpr simple_static_vector operator=(const simple_static_vector& other)
+                constexpr simple_static_vector& operator=(const simple_static_vector& other)
                 {
                     if (this == &other) {
                         return *this;
@@ -772,7 +1206,7 @@ namespace computoc {
                     other.size_ = 0;
                 }
 
-                constexpr simple_static_vector operator=(simple_static_vector&& other) noexcept
+                constexpr simple_static_vector& operator=(simple_static_vector&& other) noexcept
                 {
                     if (this == &other) {
                         return *this;
@@ -802,6 +1236,31 @@ namespace computoc {
                     return Capacity;
                 }
 
+                [[nodiscard]] constexpr bool is_external() const noexcept
+                {
+                    return false;
+                }
+
+                [[nodiscard]] constexpr bool is_copy_on_write() const noexcept
+                {
+                    return false;
+                }
+
+                [[nodiscard]] constexpr bool is_viewed() const noexcept
+                {
+                    return false;
+                }
+
+                constexpr void detach() noexcept
+                {
+                }
+
+                template <typename Func>
+                [[nodiscard]] constexpr const Func* release_target() const noexcept
+                {
+                    return nullptr;
+                }
+
                 [[nodiscard]] constexpr pointer data() const noexcept
                 {
                     return const_cast<pointer>(data_ptr_);
@@ -917,52 +1376,300 @@ namespace computoc {
         //template <typename T, template<typename> typename Allocator = Lightweight_stl_allocator>
         //using simple_vector = simple_dynamic_vector<T, Allocator>;//std::vector<T, Allocator<T>>;
 
-        template <typename T, typename U>
-        [[nodiscard]] inline bool operator==(const std::span<T>& lhs, const std::span<U>& rhs) {
-            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-        }
-
-        /*
-        * N-dimensional array definitions:
-        * ================================
-        * 
-        * N - number of dimensions
-        * All sizes of defined groups are proportional to N.
-        * 
-        * Dimensions:
-        * -----------
-        * D = {n(1), n(2), ..., n(N)}
-        * The dimensions order is from the larges to the smallest (i.e. columns).
-        * 
-        * Ranges:
-        * -------
-        * R = {(Rs(1),Re(1),Rt(1)), (Rs(2),Re(2),Rt(2)), ..., (Rs(N),Re(N),Rt(N))}
-        * s.t. Rs - start index
-        *      Re - stop index
-        *      Rt - step
-        * 
-        * Strides:
-        * --------
-        * S = {s(1), s(2), ..., s(N)}
-        * s.t. s(i) - the elements count between two consecutive elements of the i(th) dimension.
-        * 
-        * Offset:
-        * -------
-        * The start index of the current array or sub-array.
-        * Has value of 0 for the base array.
-        * 
-        * Subscripts:
-        * -----------
-        * I = {I(1), I(2), ..., I(N)}
-        * s.t. I is a group of subscripts of specific value in the array.
+        /**
+        * @note Vector storing up to Inline_capacity elements inside the object itself, and allocating from Allocator only
+        * when it grows beyond that. Used for dimensions and strides, which rarely exceed a few elements, so that headers and
+        * subarrays are created without heap allocations.
         */
+        template <typename T, std::int64_t Inline_capacity, template<typename> typename Allocator = Lightweight_stl_allocator>
+        requires (std::is_trivially_copyable_v<T> && Inline_capacity > 0)
+            class simple_small_vector final {
+            public:
+                using value_type = T;
+                using size_type = std::int64_t;
+                using reference = T&;
+                using const_reference = const T&;
+                using pointer = T*;
+                using const_pointer = const T*;
 
-        /*
-        * N-dimensional array indexing:
-        * =============================
-        * 
-        * Dimensions to strides:
-        * ----------------------
+                constexpr simple_small_vector(size_type size = 0, const_pointer data = nullptr)
+                {
+                    allocate_data(size);
+                    size_ = size;
+                    if (data) {
+                        std::copy_n(data, size_, data_ptr_);
+                    }
+                }
+
+                template <typename InputIt>
+                constexpr simple_small_vector(InputIt first, InputIt last)
+                {
+                    allocate_data(last - first);
+                    size_ = last - first;
+                    std::copy(first, last, data_ptr_);
+                }
+
+                constexpr simple_small_vector(const simple_small_vector& other)
+                    : simple_small_vector(other.size_, other.data_ptr_)
+                {
+                }
+
+                constexpr simple_small_vector& operator=(const simple_small_vector& other)
+                {
+                    if (this == &other) {
+                        return *this;
+                    }
+
+                    if (other.size_ > capacity_) {
+                        deallocate_data();
+                        allocate_data(other.size_);
+                    }
+                    size_ = other.size_;
+                    std::copy_n(other.data_ptr_, other.size_, data_ptr_);
+
+                    return *this;
+                }
+
+                constexpr simple_small_vector(simple_small_vector&& other) noexcept
+                {
+                    take(other);
+                }
+
+                constexpr simple_small_vector& operator=(simple_small_vector&& other) noexcept
+                {
+                    if (this == &other) {
+                        return *this;
+                    }
+
+                    deallocate_data();
+                    take(other);
+
+                    return *this;
+                }
+
+                constexpr ~simple_small_vector() noexcept
+                {
+                    deallocate_data();
+                }
+
+                [[nodiscard]] constexpr bool empty() const noexcept
+                {
+                    return size_ == 0;
+                }
+
+                [[nodiscard]] constexpr size_type size() const noexcept
+                {
+                    return size_;
+                }
+
+                [[nodiscard]] constexpr size_type capacity() const noexcept
+                {
+                    return capacity_;
+                }
+
+                /**
+                * @note Returns true if the elements are stored inside the object.
+                */
+                [[nodiscard]] constexpr bool is_inline() const noexcept
+                {
+                    return data_ptr_ == inline_data_;
+                }
+
+                [[nodiscard]] constexpr pointer data() const noexcept
+                {
+                    return const_cast<pointer>(data_ptr_);
+                }
+
+                [[nodiscard]] constexpr reference operator[](size_type index) noexcept
+                {
+                    return data_ptr_[index];
+                }
+
+                [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+                {
+                    return data_ptr_[index];
+                }
+
+                constexpr void resize(size_type new_size)
+                {
+                    reserve(new_size);
+                    size_ = new_size;
+                }
+
+                constexpr void reserve(size_type new_capacity)
+                {
+                    // if (new_capacity <= capacity_) do nothing
+                    if (new_capacity > capacity_) {
+                        pointer new_data_ptr = alloc_.allocate(new_capacity);
+                        std::copy_n(data_ptr_, size_, new_data_ptr);
+
+                        deallocate_data();
+                        data_ptr_ = new_data_ptr;
+                        capacity_ = new_capacity;
+                    }
+                }
+
+                constexpr void expand(size_type count)
+                {
+                    if (size_ + count > capacity_) {
+                        reserve(static_cast<size_type>(1.5 * (size_ + count)));
+                    }
+                    size_ += count;
+                }
+
+                constexpr void shrink(size_type count)
+                {
+                    if (count > size_) {
+                        throw std::length_error("count > size_");
+                    }
+                    size_ -= count;
+                }
+
+                constexpr void shrink_to_fit()
+                {
+                    if (!is_inline() && capacity_ > size_) {
+                        pointer data_ptr = size_ > Inline_capacity ? alloc_.allocate(size_) : inline_data_;
+                        std::copy_n(data_ptr_, size_, data_ptr);
+
+                        deallocate_data();
+                        data_ptr_ = data_ptr;
+                        capacity_ = std::max(size_, Inline_capacity);
+                    }
+                }
+
+                [[nodiscard]] constexpr pointer begin() noexcept
+                {
+                    return data_ptr_;
+                }
+
+                [[nodiscard]] constexpr pointer end() noexcept
+                {
+                    return data_ptr_ + size_;
+                }
+
+                [[nodiscard]] constexpr const T& back() const noexcept
+                {
+                    return data_ptr_[size_ - 1];
+                }
+
+                [[nodiscard]] constexpr T& back() noexcept
+                {
+                    return data_ptr_[size_ - 1];
+                }
+
+                [[nodiscard]] constexpr const T& front() const noexcept
+                {
+                    return data_ptr_[0];
+                }
+
+                [[nodiscard]] constexpr T& front() noexcept
+                {
+                    return data_ptr_[0];
+                }
+
+            private:
+                constexpr void allocate_data(size_type capacity)
+                {
+                    if (capacity > Inline_capacity) {
+                        data_ptr_ = alloc_.allocate(capacity);
+                        capacity_ = capacity;
+                    }
+                    else {
+                        data_ptr_ = inline_data_;
+                        capacity_ = Inline_capacity;
+                    }
+                }
+
+                constexpr void deallocate_data() noexcept
+                {
+                    if (!is_inline()) {
+                        alloc_.deallocate(data_ptr_, capacity_);
+                    }
+                    data_ptr_ = inline_data_;
+                    capacity_ = Inline_capacity;
+                }
+
+                constexpr void take(simple_small_vector& other) noexcept
+                {
+                    size_ = other.size_;
+                    if (other.is_inline()) {
+                        data_ptr_ = inline_data_;
+                        capacity_ = Inline_capacity;
+                        std::copy_n(other.inline_data_, other.size_, inline_data_);
+                    }
+                    else {
+                        data_ptr_ = other.data_ptr_;
+                        capacity_ = other.capacity_;
+                        other.data_ptr_ = other.inline_data_;
+                        other.capacity_ = Inline_capacity;
+                    }
+                    other.size_ = 0;
+                }
+
+                value_type inline_data_[Inline_capacity];
+                pointer data_ptr_{ inline_data_ };
+
+                size_type size_{ 0 };
+                size_type capacity_{ Inline_capacity };
+
+                Allocator<T> alloc_;
+        };
+
+        /**
+        * @note Number of dimensions stored inline by headers and generators of arrays with dynamic dimensions capacity.
+        */
+        inline constexpr std::int64_t inline_dims_capacity = 8;
+
+        template <std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Allocator = Lightweight_stl_allocator>
+        requires (Dims_capacity > 0)
+        using simple_dims_vector = std::conditional_t<Dims_capacity == dynamic_sequence, simple_small_vector<std::int64_t, inline_dims_capacity, Allocator>, simple_static_vector<std::int64_t, Dims_capacity>>;
+
+        template <typename T, typename U>
+        [[nodiscard]] inline bool operator==(const std::span<T>& lhs, const std::span<U>& rhs) {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        /*
+        * N-dimensional array definitions:
+        * ================================
+        * 
+        * N - number of dimensions
+        * All sizes of defined groups are proportional to N.
+        * 
+        * Dimensions:
+        * -----------
+        * D = {n(1), n(2), ..., n(N)}
+        * The dimensions order is from the larges to the smallest (i.e. columns).
+        * 
+        * Ranges:
+        * -------
+        * R = {(Rs(1),Re(1),Rt(1)), (Rs(2),Re(2),Rt(2)), ..., (Rs(N),Re(N),Rt(N))}
+        * s.t. Rs - start index
+        *      Re - stop index
+        *      Rt - step
+        * 
+        * Strides:
+        * --------
+        * S = {s(1), s(2), ..., s(N)}
+        * s.t. s(i) - the elements count between two consecutive elements of the i(th) dimension.
+        * 
+        * Offset:
+        * -------
+        * The start index of the current array or sub-array.
+        * Has value of 0 for the base array.
+        * 
+        * Subscripts:
+        * -----------
+        * I = {I(1), I(2), ..., I(N)}
+        * s.t. I is a group of subscripts of specific value in the array.
+        */
+
+        /*
+        * N-dimensional array indexing:
+        * =============================
+        * 
+        * Dimensions to strides:
+        * ----------------------
         * Relates to the original array dimensions for the base strides calculation.
         * s(N) = 1
         * s(i) = f(S,D) = s(i+1) * n(i+1) - for every i in {1, 2, ..., N-1}
@@ -1041,9 +1748,9 @@ namespace computoc {
         /**
         * @param[out] strides An already allocated memory for computed strides.
         * @return Number of computed strides
-        * @note When number of interval is smaller than number of strides, the other strides computed from previous dimensions.
+        * @note When number of interval is smaller than number of strides, the other strides are the previous strides.
         */
-        inline std::int64_t compute_strides(std::span<const std::int64_t> previous_dims, std::span<const std::int64_t> previous_strides, std::span<const Interval<std::int64_t>> intervals, std::span<std::int64_t> strides) noexcept
+        inline std::int64_t compute_strides(std::span<const std::int64_t> previous_strides, std::span<const Interval<std::int64_t>> intervals, std::span<std::int64_t> strides) noexcept
         {
             std::int64_t nstrides{ std::ssize(previous_strides) > std::ssize(strides) ? std::ssize(strides) : std::ssize(previous_strides) };
             if (nstrides <= 0) {
@@ -1057,12 +1764,9 @@ namespace computoc {
                 strides[i] = previous_strides[i] * forward(intervals[i]).step;
             }
 
-            // compute strides from previous dimensions
-            if (intervals.size() < previous_dims.size() && nstrides >= previous_dims.size()) {
-                strides[previous_dims.size() - 1] = 1;
-                for (std::int64_t i = std::ssize(previous_dims) - 2; i >= std::ssize(intervals); --i) {
-                    strides[i] = strides[i + 1] * previous_dims[i + 1];
-                }
+            // axes without intervals keep their previous strides
+            for (std::int64_t i = ncomp_from_intervals; i < nstrides; ++i) {
+                strides[i] = previous_strides[i];
             }
 
             return nstrides;
@@ -1140,33 +1844,174 @@ namespace computoc {
             return ind;
         }
 
-        /*
-        Example:
-        ========
-        D = {2, 2, 2, 2, 3}
-        N = 5
-        Data =
+        /**
+        * @note Subscripts are expected to be inside the dimensions, and their number equal to the number of strides.
+        */
+        [[nodiscard]] inline std::int64_t subs2ind_unchecked(std::int64_t offset, std::span<const std::int64_t> strides, std::span<const std::int64_t> subs) noexcept
         {
-            {{{{1, 2, 3},
-            {4, 5, 6}},
+            std::int64_t ind{ offset };
+            for (std::int64_t i = 0; i < std::ssize(strides); ++i) {
+                ind += strides[i] * subs[i];
+            }
+            return ind;
+        }
 
-            {{7, 8, 9},
-            {10, 11, 12}}},
+        /**
+        * @param pos Position of an element in a dense array with the same dimensions.
+        * @return Buffer index of the element.
+        */
+        [[nodiscard]] inline std::int64_t pos2ind(std::int64_t offset, std::span<const std::int64_t> strides, std::span<const std::int64_t> dims, std::int64_t pos) noexcept
+        {
+            std::int64_t ind{ offset };
 
+            for (std::int64_t i = std::ssize(dims) - 1; i >= 0; --i) {
+                ind += (pos % dims[i]) * strides[i];
+                pos /= dims[i];
+            }
 
-            {{{13, 14, 15},
-            {16, 17, 18}},
+            return ind;
+        }
 
-            {{19, 20, 21},
-            {22, 23, 24}}}},
+        /**
+        * @param[out] dims An already allocated memory for computed dimensions, of the size of the larger dimensions.
+        * @return Number of computed dimensions, or zero if the dimensions cannot be broadcast.
+        * @note Dimensions are aligned to the right, and each pair of dimensions should be either equal or contain 1.
+        */
+        inline std::int64_t compute_broadcast_dims(std::span<const std::int64_t> lhs_dims, std::span<const std::int64_t> rhs_dims, std::span<std::int64_t> dims) noexcept
+        {
+            std::int64_t num_dims{ std::max(std::ssize(lhs_dims), std::ssize(rhs_dims)) };
+            if (lhs_dims.empty() || rhs_dims.empty() || std::ssize(dims) < num_dims) {
+                return 0;
+            }
 
+            for (std::int64_t i = num_dims - 1; i >= 0; --i) {
+                std::int64_t lhs_i{ i - (num_dims - std::ssize(lhs_dims)) };
+                std::int64_t rhs_i{ i - (num_dims - std::ssize(rhs_dims)) };
+                std::int64_t lhs_dim{ lhs_i >= 0 ? lhs_dims[lhs_i] : 1 };
+                std::int64_t rhs_dim{ rhs_i >= 0 ? rhs_dims[rhs_i] : 1 };
 
+                if (lhs_dim != rhs_dim && lhs_dim != 1 && rhs_dim != 1) {
+                    return 0;
+                }
+                dims[i] = lhs_dim == 1 ? rhs_dim : lhs_dim;
+            }
+            return num_dims;
+        }
 
-            {{{{25, <26>, 27},
-            {28, <29>, 30}},
+        /**
+        * @param[out] strides An already allocated memory for computed strides, of the size of the broadcast dimensions.
+        * @return Number of computed strides
+        * @note Strides of broadcast dimensions are zero, so that the same elements are read again for each of their positions.
+        */
+        inline std::int64_t compute_broadcast_strides(std::span<const std::int64_t> previous_dims, std::span<const std::int64_t> previous_strides, std::span<const std::int64_t> dims, std::span<std::int64_t> strides) noexcept
+        {
+            std::int64_t num_strides{ std::ssize(dims) > std::ssize(strides) ? std::ssize(strides) : std::ssize(dims) };
 
-            {{31, 32, 33},
-            {34, 35, 36}}},
+            for (std::int64_t i = 0; i < num_strides; ++i) {
+                std::int64_t previous_i{ i - (std::ssize(dims) - std::ssize(previous_dims)) };
+                strides[i] = (previous_i < 0 || previous_dims[previous_i] != dims[i]) ? 0 : previous_strides[previous_i];
+            }
+            return num_strides;
+        }
+
+        /**
+        * @param[out] strides An already allocated memory for computed strides, of the size of the new dimensions.
+        * @return Number of computed strides, or zero if the previous elements cannot be viewed by the new dimensions
+        * @note Consecutive previous and new dimensions are grouped by equal number of elements. The elements of a group are
+        * viewed without copying if its previous dimensions are laid out contiguously relative to each other, i.e. each stride
+        * is the product of the next dimension and stride. Dimensions of size one are ignored.
+        */
+        inline std::int64_t compute_reshape_strides(std::span<const std::int64_t> previous_dims, std::span<const std::int64_t> previous_strides, std::span<const std::int64_t> dims, std::span<std::int64_t> strides) noexcept
+        {
+            if (std::ssize(strides) < std::ssize(dims) || numel(dims) <= 0 || numel(dims) != numel(previous_dims)) {
+                return 0;
+            }
+
+            const std::int64_t previous_ndims{ std::ssize(previous_dims) };
+            const std::int64_t ndims{ std::ssize(dims) };
+
+            std::int64_t pi{ 0 };
+            std::int64_t ni{ 0 };
+            while (pi < previous_ndims && ni < ndims) {
+                if (previous_dims[pi] == 1) {
+                    ++pi;
+                    continue;
+                }
+
+                std::int64_t pj{ pi + 1 };
+                std::int64_t nj{ ni + 1 };
+                std::int64_t previous_group_count{ previous_dims[pi] };
+                std::int64_t group_count{ dims[ni] };
+                while (group_count != previous_group_count) {
+                    if (group_count < previous_group_count) {
+                        group_count *= dims[nj++];
+                    }
+                    else {
+                        previous_group_count *= previous_dims[pj++];
+                    }
+                }
+
+                std::int64_t group_stride{ 0 };
+                std::int64_t next_stride{ 0 };
+                bool has_inner_dim{ false };
+                for (std::int64_t k = pj - 1; k >= pi; --k) {
+                    if (previous_dims[k] == 1) {
+                        continue;
+                    }
+                    if (!has_inner_dim) {
+                        group_stride = previous_strides[k];
+                        has_inner_dim = true;
+                    }
+                    else if (previous_strides[k] != next_stride) {
+                        return 0;
+                    }
+                    next_stride = previous_dims[k] * previous_strides[k];
+                }
+
+                strides[nj - 1] = group_stride;
+                for (std::int64_t k = nj - 1; k > ni; --k) {
+                    strides[k - 1] = strides[k] * dims[k];
+                }
+
+                pi = pj;
+                ni = nj;
+            }
+
+            const std::int64_t last_stride{ ni > 0 ? strides[ni - 1] : 1 };
+            for (std::int64_t k = ni; k < ndims; ++k) {
+                strides[k] = last_stride;
+            }
+
+            return ndims;
+        }
+
+        /*
+        Example:
+        ========
+        D = {2, 2, 2, 2, 3}
+        N = 5
+        Data =
+        {
+            {{{{1, 2, 3},
+            {4, 5, 6}},
+
+            {{7, 8, 9},
+            {10, 11, 12}}},
+
+
+            {{{13, 14, 15},
+            {16, 17, 18}},
+
+            {{19, 20, 21},
+            {22, 23, 24}}}},
+
+
+
+            {{{{25, <26>, 27},
+            {28, <29>, 30}},
+
+            {{31, 32, 33},
+            {34, 35, 36}}},
 
 
             {{{37, 38, 39},
@@ -1204,6 +2049,19 @@ namespace computoc {
         offset = 28
         */
 
+        /**
+        * @note Selects the Array_header constructor of a broadcast view.
+        */
+        struct Broadcast_tag {};
+
+        /**
+        * @note Selects the Array_header constructor of a reshaped view, which is empty if the elements cannot be viewed by the new dimensions.
+        */
+        struct Reshape_tag {};
+
+        struct Copy_on_write_tag {};
+        inline constexpr Copy_on_write_tag copy_on_write{};
+
         template <std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Internal_allocator = Lightweight_stl_allocator>
         class Array_header {
         public:
@@ -1215,9 +2073,9 @@ namespace computoc {
                     return;
                 }
 
-                dims_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(dims.begin(), dims.end());
+                dims_ = simple_dims_vector<Dims_capacity, Internal_allocator>(dims.begin(), dims.end());
 
-                strides_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(dims.size());
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(dims.size());
                 compute_strides(dims, strides_);
 
                 last_index_ = offset_ + std::inner_product(dims_.begin(), dims_.end(), strides_.begin(), 0,
@@ -1231,7 +2089,7 @@ namespace computoc {
                     return;
                 }
 
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator> dims = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                simple_dims_vector<Dims_capacity, Internal_allocator> dims = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
 
                 if (compute_dims(previous_hdr.dims(), intervals, dims) <= 0) {
                     return;
@@ -1241,8 +2099,15 @@ namespace computoc {
                 
                 count_ = numel(dims_);
 
-                strides_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
-                compute_strides(previous_hdr.dims(), previous_hdr.strides(), intervals, strides_);
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                compute_strides(previous_hdr.strides(), intervals, strides_);
+
+                // a size-1 axis is never stepped over, so it keeps its previous stride and an unsliced array keeps its row-major strides
+                for (std::int64_t i = 0; i < std::ssize(dims_); ++i) {
+                    if (dims_[i] == 1) {
+                        strides_[i] = previous_hdr.strides()[i];
+                    }
+                }
 
                 offset_ = compute_offset(previous_hdr.dims(), previous_hdr.offset(), previous_hdr.strides(), intervals);
 
@@ -1263,7 +2128,7 @@ namespace computoc {
                 std::int64_t axis{ modulo(omitted_axis, std::ssize(previous_hdr.dims())) };
                 std::int64_t ndims{ std::ssize(previous_hdr.dims()) > 1 ? std::ssize(previous_hdr.dims()) - 1 : 1 };
 
-                dims_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(ndims);
+                dims_ = simple_dims_vector<Dims_capacity, Internal_allocator>(ndims);
 
                 if (previous_hdr.dims().size() > 1) {
                     for (std::int64_t i = 0; i < axis; ++i) {
@@ -1277,7 +2142,7 @@ namespace computoc {
                     dims_[0] = 1;
                 }
 
-                strides_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(ndims);
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(ndims);
                 compute_strides(dims_, strides_);
 
                 count_ = numel(dims_);
@@ -1298,7 +2163,7 @@ namespace computoc {
                     return;
                 }
 
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator> dims = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                simple_dims_vector<Dims_capacity, Internal_allocator> dims = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
 
                 for (std::int64_t i = 0; i < std::ssize(previous_hdr.dims()); ++i) {
                     dims[i] = previous_hdr.dims()[modulo(new_order[i], std::ssize(previous_hdr.dims()))];
@@ -1310,7 +2175,7 @@ namespace computoc {
 
                 dims_ = std::move(dims);
 
-                strides_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
                 compute_strides(dims_, strides_);
 
                 count_ = numel(dims_);
@@ -1327,7 +2192,7 @@ namespace computoc {
                     return;
                 }
 
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator> dims = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                simple_dims_vector<Dims_capacity, Internal_allocator> dims = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
 
                 std::int64_t fixed_axis{ modulo(axis, std::ssize(previous_hdr.dims())) };
                 for (std::int64_t i = 0; i < previous_hdr.dims().size(); ++i) {
@@ -1340,7 +2205,7 @@ namespace computoc {
 
                 dims_ = std::move(dims);
 
-                strides_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
                 compute_strides(dims_, strides_);
 
                 last_index_ = offset_ + std::inner_product(dims_.begin(), dims_.end(), strides_.begin(), 0,
@@ -1375,7 +2240,7 @@ namespace computoc {
                     return;
                 }
 
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator> dims = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                simple_dims_vector<Dims_capacity, Internal_allocator> dims = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
 
                 for (std::int64_t i = 0; i < previous_hdr.dims().size(); ++i) {
                     dims[i] = (i != fixed_axis) ? previous_hdr.dims()[i] : previous_hdr.dims()[i] + appended_dims[fixed_axis];
@@ -1387,7 +2252,7 @@ namespace computoc {
 
                 dims_ = std::move(dims);
 
-                strides_ = simple_vector<std::int64_t, Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(previous_hdr.dims().size());
                 compute_strides(dims_, strides_);
 
                 last_index_ = offset_ + std::inner_product(dims_.begin(), dims_.end(), strides_.begin(), 0,
@@ -1395,6 +2260,64 @@ namespace computoc {
                     [](auto a, auto b) { return (a - 1) * b; });
             }
 
+            /**
+            * @note The created header views the same elements as the previous header, with zero strides for broadcast dimensions.
+            * Arrays of such headers should be iterated by position (e.g. pos2ind), since several positions share the same index.
+            */
+            Array_header(const Array_header<Dims_capacity, Internal_allocator>& previous_hdr, std::span<const std::int64_t> broadcast_dims, Broadcast_tag)
+            {
+                if (numel(previous_hdr.dims()) <= 0) {
+                    return;
+                }
+
+                if (std::ssize(broadcast_dims) < std::ssize(previous_hdr.dims())) {
+                    return;
+                }
+
+                simple_dims_vector<Dims_capacity, Internal_allocator> dims = simple_dims_vector<Dims_capacity, Internal_allocator>(broadcast_dims.size());
+
+                if (compute_broadcast_dims(previous_hdr.dims(), broadcast_dims, dims) <= 0
+                    || !std::equal(dims.begin(), dims.end(), broadcast_dims.begin(), broadcast_dims.end())) {
+                    return;
+                }
+
+                dims_ = std::move(dims);
+
+                count_ = numel(dims_);
+
+                strides_ = simple_dims_vector<Dims_capacity, Internal_allocator>(broadcast_dims.size());
+                compute_broadcast_strides(previous_hdr.dims(), previous_hdr.strides(), dims_, strides_);
+
+                offset_ = previous_hdr.offset();
+
+                last_index_ = offset_ + std::inner_product(dims_.begin(), dims_.end(), strides_.begin(), 0,
+                    [](auto a, auto b) { return a + b; },
+                    [](auto a, auto b) { return (a - 1) * b; });
+
+                is_subarray_ = previous_hdr.is_subarray() || !std::equal(previous_hdr.dims().begin(), previous_hdr.dims().end(), dims_.begin(), dims_.end());
+            }
+
+            Array_header(const Array_header<Dims_capacity, Internal_allocator>& previous_hdr, std::span<const std::int64_t> new_dims, Reshape_tag)
+                : is_subarray_(previous_hdr.is_subarray())
+            {
+                simple_dims_vector<Dims_capacity, Internal_allocator> strides = simple_dims_vector<Dims_capacity, Internal_allocator>(new_dims.size());
+
+                if (compute_reshape_strides(previous_hdr.dims(), previous_hdr.strides(), new_dims, strides) <= 0) {
+                    return;
+                }
+
+                dims_ = simple_dims_vector<Dims_capacity, Internal_allocator>(new_dims.begin(), new_dims.end());
+                strides_ = std::move(strides);
+
+                count_ = numel(dims_);
+
+                offset_ = previous_hdr.offset();
+
+                last_index_ = offset_ + std::inner_product(dims_.begin(), dims_.end(), strides_.begin(), 0,
+                    [](auto a, auto b) { return a + b; },
+                    [](auto a, auto b) { return (a - 1) * b; });
+            }
+
             Array_header(Array_header&& other) = default;
             Array_header& operator=(Array_header&& other) = default;
 
@@ -1439,8 +2362,8 @@ namespace computoc {
             }
 
         private:
-            simple_vector<std::int64_t, Dims_capacity, Internal_allocator> dims_{};
-            simple_vector<std::int64_t, Dims_capacity, Internal_allocator> strides_{};
+            simple_dims_vector<Dims_capacity, Internal_allocator> dims_{};
+            simple_dims_vector<Dims_capacity, Internal_allocator> strides_{};
             std::int64_t count_{ 0 };
             std::int64_t offset_{ 0 };
             std::int64_t last_index_{ 0 };
@@ -1451,12 +2374,16 @@ namespace computoc {
         template <std::int64_t Dims_capacity, template<typename> typename Internal_allocator>
         class Array_indices_generator;
 
+        template <std::int64_t Dims_capacity, template<typename> typename Internal_allocator>
+        class Array_iteration_layout;
+
 
         template <std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Internal_allocator = Lightweight_stl_allocator>
         class Simple_array_indices_generator final
         {
         public:
             friend class Array_indices_generator<Dims_capacity, Internal_allocator>;
+            friend class Array_iteration_layout<Dims_capacity, Internal_allocator>;
 
             constexpr Simple_array_indices_generator(const Array_header<Dims_capacity, Internal_allocator>& hdr, bool backward = false)
                 : Simple_array_indices_generator(hdr, std::span<const std::int64_t>{}, backward)
@@ -1488,6 +2415,11 @@ namespace computoc {
                     first_stride_ = strides_[ndims_ - 1];
                     first_ind_ = backward ? first_dim_ - 1 : 0;
                 }
+                else {
+                    first_dim_ = 1;
+                    first_stride_ = 1;
+                    first_ind_ = 0;
+                }
 
                 if (ndims_ > 1) {
                     second_dim_ = dims_[ndims_ - 2];
@@ -1669,10 +2601,37 @@ namespace computoc {
                 return current_index_;
             }
 
+            /**
+            * @return Number of elements left in the current innermost run, starting at the current index.
+            * @note The elements of a run are run_stride() apart, and can be processed in bulk before calling next_run().
+            */
+            [[nodiscard]] constexpr std::int64_t run_length() const noexcept
+            {
+                return first_dim_ - first_ind_;
+            }
+
+            [[nodiscard]] constexpr std::int64_t run_stride() const noexcept
+            {
+                return first_stride_;
+            }
+
+            /**
+            * @note Skips the rest of the current run, equivalent to advancing run_length() elements.
+            */
+            constexpr Simple_array_indices_generator<Dims_capacity, Internal_allocator>& next_run() noexcept
+            {
+                if (current_index_ < first_index_ || current_index_ > last_index_) {
+                    return ++(*this);
+                }
+                current_index_ += (first_dim_ - 1 - first_ind_) * first_stride_;
+                first_ind_ = first_dim_ - 1;
+                return ++(*this);
+            }
+
         private:
-            constexpr static simple_vector<std::int64_t, Dims_capacity, Internal_allocator> order_from_major_axis(std::int64_t order_size, std::int64_t axis)
+            constexpr static simple_dims_vector<Dims_capacity, Internal_allocator> order_from_major_axis(std::int64_t order_size, std::int64_t axis)
             {
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator> new_ordered_indices(order_size);
+                simple_dims_vector<Dims_capacity, Internal_allocator> new_ordered_indices(order_size);
                 std::iota(new_ordered_indices.begin(), new_ordered_indices.end(), static_cast<std::int64_t>(0));
                 new_ordered_indices[0] = axis;
                 std::int64_t pos = 1;
@@ -1684,10 +2643,10 @@ namespace computoc {
                 return new_ordered_indices;
             }
 
-            constexpr static simple_vector<std::int64_t, Dims_capacity, Internal_allocator> reorder(std::span<const std::int64_t> vec, std::span<const std::int64_t> indices)
+            constexpr static simple_dims_vector<Dims_capacity, Internal_allocator> reorder(std::span<const std::int64_t> vec, std::span<const std::int64_t> indices)
             {
                 std::size_t size = std::min(vec.size(), indices.size());
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator> res(size);
+                simple_dims_vector<Dims_capacity, Internal_allocator> res(size);
                 for (std::int64_t i = 0; i < size; ++i) {
                     res[i] = vec[indices[i]];
                 }
@@ -1695,12 +2654,12 @@ namespace computoc {
             }
 
             constexpr static std::tuple<
-                simple_vector<std::int64_t, Dims_capacity, Internal_allocator>, simple_vector<std::int64_t, Dims_capacity, Internal_allocator>>
+                simple_dims_vector<Dims_capacity, Internal_allocator>, simple_dims_vector<Dims_capacity, Internal_allocator>>
                 reduce_dimensions(std::span<const std::int64_t> dims, std::span<const std::int64_t> strides)
             {
                 std::tuple<
-                    simple_vector<std::int64_t, Dims_capacity, Internal_allocator>,
-                    simple_vector<std::int64_t, Dims_capacity, Internal_allocator>> reds(dims.size(), dims.size());
+                    simple_dims_vector<Dims_capacity, Internal_allocator>,
+                    simple_dims_vector<Dims_capacity, Internal_allocator>> reds(dims.size(), dims.size());
 
                 auto& [rdims, rstrides] = reds;
 
@@ -1716,12 +2675,21 @@ namespace computoc {
                     }
                 }
 
-                for (std::int64_t i = rndims - 1; i >= 1; --i) {
-                    if (rdims[i] == rstrides[i - 1]) {
-                        rdims[i - 1] *= rdims[i];
-                        rstrides[i - 1] = rstrides[i];
-                        --rndims;
+                // merge each dimension into its outer neighbour when both are a single contiguous run, i.e. stride[i - 1] == dims[i] * stride[i]
+                if (rndims > 1) {
+                    std::int64_t mi = 0;
+                    for (std::int64_t i = 1; i < rndims; ++i) {
+                        if (rstrides[mi] == rdims[i] * rstrides[i]) {
+                            rdims[mi] *= rdims[i];
+                            rstrides[mi] = rstrides[i];
+                        }
+                        else {
+                            ++mi;
+                            rdims[mi] = rdims[i];
+                            rstrides[mi] = rstrides[i];
+                        }
                     }
+                    rndims = mi + 1;
                 }
 
                 if (rndims != dims.size()) {
@@ -1732,8 +2700,8 @@ namespace computoc {
                 return reds;
             }
 
-            simple_vector<std::int64_t, Dims_capacity, Internal_allocator> dims_;
-            simple_vector<std::int64_t, Dims_capacity, Internal_allocator> strides_;
+            simple_dims_vector<Dims_capacity, Internal_allocator> dims_;
+            simple_dims_vector<Dims_capacity, Internal_allocator> strides_;
             std::int64_t first_index_;
             std::int64_t last_index_;
             std::int64_t last_first_diff_;
@@ -1751,7 +2719,7 @@ namespace computoc {
             std::int64_t third_dim_;
             std::int64_t third_ind_;
 
-            simple_vector<std::int64_t, Dims_capacity, Internal_allocator> indices_;
+            simple_dims_vector<Dims_capacity, Internal_allocator> indices_;
             std::int64_t current_index_;
         };
 
@@ -1784,6 +2752,14 @@ namespace computoc {
                 step_size_inside_group_ = hdr.strides().back();
                 step_size_between_groups_ = num_super_groups_ * step_size_between_super_groups_;
 
+                // for the major axis the super groups follow each other, hence iterated as a single group
+                if (axis == 0) {
+                    num_super_groups_ = 1;
+                    step_size_between_super_groups_ = last_index_ + 1;
+                    group_size_ = last_index_ + 1;
+                    step_size_between_groups_ = last_index_ + 1;
+                }
+
                 // accumulators
                 if (!backward) {
                     current_index_ = 0;
@@ -1993,6 +2969,33 @@ namespace computoc {
                 return current_index_;
             }
 
+            /**
+            * @return Number of elements left in the current group, starting at the current index.
+            * @note The elements of a run are run_stride() apart, and can be processed in bulk before calling next_run().
+            */
+            [[nodiscard]] constexpr std::int64_t run_length() const noexcept
+            {
+                return group_size_ - group_indices_counter_;
+            }
+
+            [[nodiscard]] constexpr std::int64_t run_stride() const noexcept
+            {
+                return step_size_inside_group_;
+            }
+
+            /**
+            * @note Skips the rest of the current group, equivalent to advancing run_length() elements.
+            */
+            constexpr Fast_array_indices_generator<Dims_capacity, Internal_allocator>& next_run() noexcept
+            {
+                if (current_index_ < 0 || current_index_ > last_index_) {
+                    return ++(*this);
+                }
+                current_index_ += (group_size_ - 1 - group_indices_counter_) * step_size_inside_group_;
+                group_indices_counter_ = group_size_ - 1;
+                return ++(*this);
+            }
+
         private:
             std::int64_t current_index_ = 0;
 
@@ -2167,6 +3170,33 @@ namespace computoc {
                 return current_index_;
             }
 
+            /**
+            * @return Number of elements left in the current run, starting at the current index.
+            * @note Contiguous dimensions are merged at construction, so a run spans as many elements as possible.
+            */
+            [[nodiscard]] constexpr std::int64_t run_length() const noexcept
+            {
+                return is_fast_ ? fast_gen_.run_length() : simple_gen_.run_length();
+            }
+
+            [[nodiscard]] constexpr std::int64_t run_stride() const noexcept
+            {
+                return is_fast_ ? fast_gen_.run_stride() : simple_gen_.run_stride();
+            }
+
+            constexpr Array_indices_generator<Dims_capacity, Internal_allocator>& next_run() noexcept
+            {
+                if (is_fast_) {
+                    fast_gen_.next_run();
+                    current_index_ = fast_gen_.current_index_;
+                }
+                else {
+                    simple_gen_.next_run();
+                    current_index_ = simple_gen_.current_index_;
+                }
+                return *this;
+            }
+
         private:
             Simple_array_indices_generator<Dims_capacity, Internal_allocator> simple_gen_;
             Fast_array_indices_generator<Dims_capacity, Internal_allocator> fast_gen_;
@@ -2184,15 +3214,101 @@ namespace computoc {
 
 
 
+        /**
+        * @note Dimensions and strides of a header view in an iteration order, reduced as by the indices generator, from which
+        * the buffer index of any position of the iteration is computed without iterating. Views whose iteration is a single
+        * run, e.g. dense arrays iterated along axis 0, compute indices by a multiplication and do not store their dimensions,
+        * so that the layout is cheap to copy. Otherwise, the reduced dimensions and strides are shared by the copies.
+        */
+        template <std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Internal_allocator = Lightweight_stl_allocator>
+        class Array_iteration_layout final
+        {
+        public:
+            Array_iteration_layout(const Array_header<Dims_capacity, Internal_allocator>& hdr, std::int64_t axis = 0)
+                : Array_iteration_layout(Simple_array_indices_generator<Dims_capacity, Internal_allocator>(hdr, axis))
+            {
+            }
+
+            Array_iteration_layout(const Array_header<Dims_capacity, Internal_allocator>& hdr, std::span<const std::int64_t> order)
+                : Array_iteration_layout(Simple_array_indices_generator<Dims_capacity, Internal_allocator>(hdr, order))
+            {
+            }
+
+            Array_iteration_layout() = default;
+
+            /**
+            * @param pos Position of an element in the iteration.
+            * @return Buffer index of the element.
+            */
+            [[nodiscard]] std::int64_t index(std::int64_t pos) const noexcept
+            {
+                if (!reduced_) {
+                    return offset_ + pos * run_stride_;
+                }
+                return pos2ind(offset_, std::span<const std::int64_t>(reduced_->strides.data(), reduced_->strides.size()), std::span<const std::int64_t>(reduced_->dims.data(), reduced_->dims.size()), pos);
+            }
+
+            /**
+            * @return Buffer index of the element at pos, given the index of the element at pos - 1.
+            */
+            [[nodiscard]] std::int64_t next_index(std::int64_t previous_index, std::int64_t pos) const noexcept
+            {
+                return (!reduced_ || pos % run_length_ != 0) ? previous_index + run_stride_ : index(pos);
+            }
+
+            /**
+            * @return Buffer index of the element at pos, given the index of the element at pos + 1.
+            */
+            [[nodiscard]] std::int64_t previous_index(std::int64_t next_index, std::int64_t pos) const noexcept
+            {
+                return (!reduced_ || (pos + 1) % run_length_ != 0) ? next_index - run_stride_ : index(pos);
+            }
+
+        private:
+            struct Reduced_dims {
+                simple_dims_vector<Dims_capacity, Internal_allocator> dims;
+                simple_dims_vector<Dims_capacity, Internal_allocator> strides;
+            };
+
+            Array_iteration_layout(const Simple_array_indices_generator<Dims_capacity, Internal_allocator>& gen)
+                : offset_(gen.first_index_), run_length_(gen.first_dim_), run_stride_(gen.first_stride_)
+            {
+                if (gen.ndims_ > 1) {
+                    reduced_ = std::allocate_shared<Reduced_dims>(Internal_allocator<Reduced_dims>(), Reduced_dims{ gen.dims_, gen.strides_ });
+                }
+            }
+
+            std::shared_ptr<const Reduced_dims> reduced_{ nullptr };
+            std::int64_t offset_{ 0 };
+            std::int64_t run_length_{ 1 };
+            std::int64_t run_stride_{ 1 };
+        };
+
+
+
+
+        /*
+        * Iterators:
+        * ==========
+        *
+        * Array iterators are random access iterators over the positions of an iteration order of the array elements.
+        * Stepping to the next position within a run of the iteration adds the run stride to the current buffer index,
+        * and other moves compute the index of the new position from the reduced dimensions and strides in O(ndims).
+        * Iterators are compared by their positions, and should be compared only with iterators of the same iteration.
+        */
+
         template <typename T, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Internal_allocator = Lightweight_stl_allocator>
         class Array_iterator final
         {
         public:
+            using iterator_category = std::random_access_iterator_tag;
             using value_type = T;
             using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
 
-            Array_iterator(T* data, const Array_indices_generator<Dims_capacity, Internal_allocator>& gen)
-                : gen_(gen), data_(data)
+            Array_iterator(T* data, const Array_iteration_layout<Dims_capacity, Internal_allocator>& layout, std::int64_t pos)
+                : layout_(layout), data_(data), pos_(pos), index_(layout_.index(pos))
             {
             }
 
@@ -2208,7 +3324,8 @@ namespace computoc {
 
             Array_iterator<T, Dims_capacity, Internal_allocator>& operator++() noexcept
             {
-                ++gen_;
+                ++pos_;
+                index_ = layout_.next_index(index_, pos_);
                 return *this;
             }
 
@@ -2219,22 +3336,29 @@ namespace computoc {
                 return temp;
             }
 
-            Array_iterator<T, Dims_capacity, Internal_allocator>& operator+=(std::int64_t count) noexcept
+            Array_iterator<T, Dims_capacity, Internal_allocator>& operator+=(difference_type count) noexcept
             {
-                gen_ += count;
+                pos_ += count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_iterator<T, Dims_capacity, Internal_allocator> operator+(std::int64_t count) noexcept
+            [[nodiscard]] Array_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count) const noexcept
             {
                 Array_iterator temp{ *this };
                 temp += count;
                 return temp;
             }
 
+            [[nodiscard]] friend Array_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count, const Array_iterator<T, Dims_capacity, Internal_allocator>& iter) noexcept
+            {
+                return iter + count;
+            }
+
             Array_iterator<T, Dims_capacity, Internal_allocator>& operator--() noexcept
             {
-                gen_--;
+                --pos_;
+                index_ = layout_.previous_index(index_, pos_);
                 return *this;
             }
 
@@ -2245,32 +3369,55 @@ namespace computoc {
                 return temp;
             }
 
-            Array_iterator<T, Dims_capacity, Internal_allocator>& operator-=(std::int64_t count) noexcept
+            Array_iterator<T, Dims_capacity, Internal_allocator>& operator-=(difference_type count) noexcept
             {
-                gen_ -= count;
+                pos_ -= count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_iterator<T, Dims_capacity, Internal_allocator> operator-(std::int64_t count) noexcept
+            [[nodiscard]] Array_iterator<T, Dims_capacity, Internal_allocator> operator-(difference_type count) const noexcept
             {
                 Array_iterator temp{ *this };
                 temp -= count;
                 return temp;
             }
 
+            [[nodiscard]] difference_type operator-(const Array_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return pos_ - iter.pos_;
+            }
+
             [[nodiscard]] T& operator*() const noexcept
             {
-                return data_[*gen_];
+                return data_[index_];
+            }
+
+            [[nodiscard]] T* operator->() const noexcept
+            {
+                return data_ + index_;
+            }
+
+            [[nodiscard]] T& operator[](difference_type count) const noexcept
+            {
+                return *(*this + count);
+            }
+
+            [[nodiscard]] bool operator==(const Array_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return pos_ == iter.pos_;
             }
 
-            [[nodiscard]] bool operator==(const Array_iterator<T, Dims_capacity, Internal_allocator>& iter) const
+            [[nodiscard]] std::strong_ordering operator<=>(const Array_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
             {
-                return *gen_ == *(iter.gen_);
+                return pos_ <=> iter.pos_;
             }
 
         private:
-            Array_indices_generator<Dims_capacity, Internal_allocator> gen_;
+            Array_iteration_layout<Dims_capacity, Internal_allocator> layout_;
             T* data_ = nullptr;
+            std::int64_t pos_ = 0;
+            std::int64_t index_ = 0;
         };
 
 
@@ -2280,8 +3427,14 @@ namespace computoc {
         class Array_const_iterator final
         {
         public:
-            Array_const_iterator(T* data, const Array_indices_generator<Dims_capacity, Internal_allocator>& gen)
-                : gen_(gen), data_(data)
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            Array_const_iterator(T* data, const Array_iteration_layout<Dims_capacity, Internal_allocator>& layout, std::int64_t pos)
+                : layout_(layout), data_(data), pos_(pos), index_(layout_.index(pos))
             {
             }
 
@@ -2297,7 +3450,8 @@ namespace computoc {
 
             Array_const_iterator<T, Dims_capacity, Internal_allocator>& operator++() noexcept
             {
-                ++gen_;
+                ++pos_;
+                index_ = layout_.next_index(index_, pos_);
                 return *this;
             }
 
@@ -2308,22 +3462,29 @@ namespace computoc {
                 return temp;
             }
 
-            Array_const_iterator<T, Dims_capacity, Internal_allocator>& operator+=(std::int64_t count) noexcept
+            Array_const_iterator<T, Dims_capacity, Internal_allocator>& operator+=(difference_type count) noexcept
             {
-                gen_ += count;
+                pos_ += count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_const_iterator<T, Dims_capacity, Internal_allocator> operator+(std::int64_t count) noexcept
+            [[nodiscard]] Array_const_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count) const noexcept
             {
                 Array_const_iterator temp{ *this };
                 temp += count;
                 return temp;
             }
 
+            [[nodiscard]] friend Array_const_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count, const Array_const_iterator<T, Dims_capacity, Internal_allocator>& iter) noexcept
+            {
+                return iter + count;
+            }
+
             Array_const_iterator<T, Dims_capacity, Internal_allocator>& operator--() noexcept
             {
-                --gen_;
+                --pos_;
+                index_ = layout_.previous_index(index_, pos_);
                 return *this;
             }
 
@@ -2334,45 +3495,72 @@ namespace computoc {
                 return temp;
             }
 
-            Array_const_iterator<T, Dims_capacity, Internal_allocator>& operator-=(std::int64_t count) noexcept
+            Array_const_iterator<T, Dims_capacity, Internal_allocator>& operator-=(difference_type count) noexcept
             {
-                gen_ -= count;
+                pos_ -= count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_const_iterator<T, Dims_capacity, Internal_allocator> operator-(std::int64_t count) noexcept
+            [[nodiscard]] Array_const_iterator<T, Dims_capacity, Internal_allocator> operator-(difference_type count) const noexcept
             {
                 Array_const_iterator temp{ *this };
                 temp -= count;
                 return temp;
             }
 
+            [[nodiscard]] difference_type operator-(const Array_const_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return pos_ - iter.pos_;
+            }
+
             [[nodiscard]] const T& operator*() const noexcept
             {
-                return data_[*gen_];
+                return data_[index_];
+            }
+
+            [[nodiscard]] const T* operator->() const noexcept
+            {
+                return data_ + index_;
+            }
+
+            [[nodiscard]] const T& operator[](difference_type count) const noexcept
+            {
+                return *(*this + count);
             }
 
-            [[nodiscard]] bool operator==(const Array_const_iterator<T, Dims_capacity, Internal_allocator>& iter) const
+            [[nodiscard]] bool operator==(const Array_const_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
             {
-                return *gen_ == *(iter.gen_);
+                return pos_ == iter.pos_;
+            }
+
+            [[nodiscard]] std::strong_ordering operator<=>(const Array_const_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return pos_ <=> iter.pos_;
             }
 
         private:
-            Array_indices_generator<Dims_capacity, Internal_allocator> gen_;
+            Array_iteration_layout<Dims_capacity, Internal_allocator> layout_;
             T* data_ = nullptr;
+            std::int64_t pos_ = 0;
+            std::int64_t index_ = 0;
         };
 
 
 
+
         template <typename T, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Internal_allocator = Lightweight_stl_allocator>
         class Array_reverse_iterator final
         {
         public:
+            using iterator_category = std::random_access_iterator_tag;
             using value_type = T;
             using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
 
-            Array_reverse_iterator(T* data, const Array_indices_generator<Dims_capacity, Internal_allocator>& gen)
-                : gen_(gen), data_(data)
+            Array_reverse_iterator(T* data, const Array_iteration_layout<Dims_capacity, Internal_allocator>& layout, std::int64_t pos)
+                : layout_(layout), data_(data), pos_(pos), index_(layout_.index(pos))
             {
             }
 
@@ -2388,69 +3576,100 @@ namespace computoc {
 
             Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator++() noexcept
             {
-                --gen_;
+                --pos_;
+                index_ = layout_.previous_index(index_, pos_);
                 return *this;
             }
 
             Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator++(int) noexcept
             {
                 Array_reverse_iterator temp{ *this };
-                --(*this);
+                ++(*this);
                 return temp;
             }
 
-            Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator+=(std::int64_t count) noexcept
+            Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator+=(difference_type count) noexcept
             {
-                gen_ -= count;
+                pos_ -= count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator+(std::int64_t count) noexcept
+            [[nodiscard]] Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count) const noexcept
             {
                 Array_reverse_iterator temp{ *this };
                 temp += count;
                 return temp;
             }
 
+            [[nodiscard]] friend Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count, const Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) noexcept
+            {
+                return iter + count;
+            }
+
             Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator--() noexcept
             {
-                ++gen_;
+                ++pos_;
+                index_ = layout_.next_index(index_, pos_);
                 return *this;
             }
 
             Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator--(int) noexcept
             {
                 Array_reverse_iterator temp{ *this };
-                ++(*this);
+                --(*this);
                 return temp;
             }
 
-            Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator-=(std::int64_t count) noexcept
+            Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator-=(difference_type count) noexcept
             {
-                gen_ += count;
+                pos_ += count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator-(std::int64_t count) noexcept
+            [[nodiscard]] Array_reverse_iterator<T, Dims_capacity, Internal_allocator> operator-(difference_type count) const noexcept
             {
                 Array_reverse_iterator temp{ *this };
                 temp -= count;
                 return temp;
             }
 
+            [[nodiscard]] difference_type operator-(const Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return iter.pos_ - pos_;
+            }
+
             [[nodiscard]] T& operator*() const noexcept
             {
-                return data_[*gen_];
+                return data_[index_];
+            }
+
+            [[nodiscard]] T* operator->() const noexcept
+            {
+                return data_ + index_;
+            }
+
+            [[nodiscard]] T& operator[](difference_type count) const noexcept
+            {
+                return *(*this + count);
             }
 
-            [[nodiscard]] bool operator==(const Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const
+            [[nodiscard]] bool operator==(const Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
             {
-                return *gen_ == *(iter.gen_);
+                return pos_ == iter.pos_;
+            }
+
+            [[nodiscard]] std::strong_ordering operator<=>(const Array_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return iter.pos_ <=> pos_;
             }
 
         private:
-            Array_indices_generator<Dims_capacity, Internal_allocator> gen_;
+            Array_iteration_layout<Dims_capacity, Internal_allocator> layout_;
             T* data_ = nullptr;
+            std::int64_t pos_ = 0;
+            std::int64_t index_ = 0;
         };
 
 
@@ -2460,8 +3679,14 @@ namespace computoc {
         class Array_const_reverse_iterator final
         {
         public:
-            Array_const_reverse_iterator(T* data, const Array_indices_generator<Dims_capacity, Internal_allocator>& gen)
-                : gen_(gen), data_(data)
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            Array_const_reverse_iterator(T* data, const Array_iteration_layout<Dims_capacity, Internal_allocator>& layout, std::int64_t pos)
+                : layout_(layout), data_(data), pos_(pos), index_(layout_.index(pos))
             {
             }
 
@@ -2477,1939 +3702,6281 @@ namespace computoc {
 
             Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator++() noexcept
             {
-                --gen_;
+                --pos_;
+                index_ = layout_.previous_index(index_, pos_);
                 return *this;
             }
 
             Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator++(int) noexcept
             {
                 Array_const_reverse_iterator temp{ *this };
-                --(*this);
+                ++(*this);
                 return temp;
             }
 
-            Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator+=(std::int64_t count) noexcept
+            Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator+=(difference_type count) noexcept
             {
-                gen_ -= count;
+                pos_ -= count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator+(std::int64_t count) noexcept
+            [[nodiscard]] Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count) const noexcept
             {
                 Array_const_reverse_iterator temp{ *this };
                 temp += count;
                 return temp;
             }
 
+            [[nodiscard]] friend Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator+(difference_type count, const Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) noexcept
+            {
+                return iter + count;
+            }
+
             Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator--() noexcept
             {
-                ++gen_;
+                ++pos_;
+                index_ = layout_.next_index(index_, pos_);
                 return *this;
             }
 
             Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator--(int) noexcept
             {
                 Array_const_reverse_iterator temp{ *this };
-                ++(*this);
+                --(*this);
                 return temp;
             }
 
-            Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator-=(std::int64_t count) noexcept
+            Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& operator-=(difference_type count) noexcept
             {
-                gen_ += count;
+                pos_ += count;
+                index_ = layout_.index(pos_);
                 return *this;
             }
 
-            Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator-(std::int64_t count) noexcept
+            [[nodiscard]] Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator> operator-(difference_type count) const noexcept
             {
                 Array_const_reverse_iterator temp{ *this };
                 temp -= count;
                 return temp;
             }
 
+            [[nodiscard]] difference_type operator-(const Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return iter.pos_ - pos_;
+            }
+
             [[nodiscard]] const T& operator*() const noexcept
             {
-                return data_[*gen_];
+                return data_[index_];
             }
 
-            [[nodiscard]] bool operator==(const Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const
+            [[nodiscard]] const T* operator->() const noexcept
             {
-                return *gen_ == *(iter.gen_);
+                return data_ + index_;
+            }
+
+            [[nodiscard]] const T& operator[](difference_type count) const noexcept
+            {
+                return *(*this + count);
+            }
+
+            [[nodiscard]] bool operator==(const Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return pos_ == iter.pos_;
+            }
+
+            [[nodiscard]] std::strong_ordering operator<=>(const Array_const_reverse_iterator<T, Dims_capacity, Internal_allocator>& iter) const noexcept
+            {
+                return iter.pos_ <=> pos_;
             }
 
         private:
-            Array_indices_generator<Dims_capacity, Internal_allocator> gen_;
+            Array_iteration_layout<Dims_capacity, Internal_allocator> layout_;
             T* data_ = nullptr;
+            std::int64_t pos_ = 0;
+            std::int64_t index_ = 0;
         };
 
 
 
 
-        template <typename T, std::int64_t Data_capacity = dynamic_sequence, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
-        class Array {
-        public:
-            using Header = Array_header<Dims_capacity, Internals_allocator>;
+        /*
+        * SIMD kernels:
+        * =============
+        *
+        * Vectorized element-wise operations for dense float, double, std::int32_t and std::int64_t buffers.
+        * The instruction set is selected at compile time from the target flags (AVX-512F, AVX2 or SSE2),
+        * and an operation without a kernel for the selected instruction set is performed by the scalar loop.
+        * Define COMPUTOC_DISABLE_SIMD to always use the scalar loops.
+        *
+        * Kernel comparison functions return a mask with a bit per lane.
+        */
 
-            Array() = default;
+        template <typename T>
+        struct Simd_kernel {};
+
+#if defined(COMPUTOC_SIMD_AVX512)
+        template <>
+        struct Simd_kernel<float> {
+            using Register = __m512;
+            static constexpr std::int64_t width = 16;
+
+            [[nodiscard]] static Register load(const float* p) noexcept { return _mm512_loadu_ps(p); }
+            static void store(float* p, Register r) noexcept { _mm512_storeu_ps(p, r); }
+            [[nodiscard]] static Register broadcast(float value) noexcept { return _mm512_set1_ps(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm512_add_ps(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm512_sub_ps(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm512_mul_ps(a, b); }
+            [[nodiscard]] static Register div(Register a, Register b) noexcept { return _mm512_div_ps(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+        };
 
-            Array(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& other) = default;
-            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
-            Array(Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>&& other)
-                : Array(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()))
-            {
-                copy(other, *this);
+        template <>
+        struct Simd_kernel<double> {
+            using Register = __m512d;
+            static constexpr std::int64_t width = 8;
+
+            [[nodiscard]] static Register load(const double* p) noexcept { return _mm512_loadu_pd(p); }
+            static void store(double* p, Register r) noexcept { _mm512_storeu_pd(p, r); }
+            [[nodiscard]] static Register broadcast(double value) noexcept { return _mm512_set1_pd(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm512_add_pd(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm512_sub_pd(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm512_mul_pd(a, b); }
+            [[nodiscard]] static Register div(Register a, Register b) noexcept { return _mm512_div_pd(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+        };
 
-                Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o> dummy{ std::move(other) };
-            }
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& other) & = default;
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& other)&&
-            {
-                if (&other == this) {
-                    return *this;
-                }
+        template <>
+        struct Simd_kernel<std::int32_t> {
+            using Register = __m512i;
+            static constexpr std::int64_t width = 16;
+
+            [[nodiscard]] static Register load(const std::int32_t* p) noexcept { return _mm512_loadu_si512(p); }
+            static void store(std::int32_t* p, Register r) noexcept { _mm512_storeu_si512(p, r); }
+            [[nodiscard]] static Register broadcast(std::int32_t value) noexcept { return _mm512_set1_epi32(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm512_add_epi32(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm512_sub_epi32(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm512_mullo_epi32(a, b); }
+
+            [[nodiscard]] static Register bit_and(Register a, Register b) noexcept { return _mm512_and_si512(a, b); }
+            [[nodiscard]] static Register bit_or(Register a, Register b) noexcept { return _mm512_or_si512(a, b); }
+            [[nodiscard]] static Register bit_xor(Register a, Register b) noexcept { return _mm512_xor_si512(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_EQ); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_NE); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_NLE); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_NLT); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_LT); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm512_cmp_epi32_mask(a, b, _MM_CMPINT_LE); }
+        };
 
-                copy(other, *this);
-                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dummy{ std::move(other) };
-                return *this;
+        template <>
+        struct Simd_kernel<std::int64_t> {
+            using Register = __m512i;
+            static constexpr std::int64_t width = 8;
+
+            [[nodiscard]] static Register load(const std::int64_t* p) noexcept { return _mm512_loadu_si512(p); }
+            static void store(std::int64_t* p, Register r) noexcept { _mm512_storeu_si512(p, r); }
+            [[nodiscard]] static Register broadcast(std::int64_t value) noexcept { return _mm512_set1_epi64(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm512_add_epi64(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm512_sub_epi64(a, b); }
+#if defined(__AVX512DQ__)
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm512_mullo_epi64(a, b); }
+#endif
+
+            [[nodiscard]] static Register bit_and(Register a, Register b) noexcept { return _mm512_and_si512(a, b); }
+            [[nodiscard]] static Register bit_or(Register a, Register b) noexcept { return _mm512_or_si512(a, b); }
+            [[nodiscard]] static Register bit_xor(Register a, Register b) noexcept { return _mm512_xor_si512(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_EQ); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_NE); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_NLE); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_NLT); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_LT); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm512_cmp_epi64_mask(a, b, _MM_CMPINT_LE); }
+        };
+#elif defined(COMPUTOC_SIMD_AVX2)
+        template <>
+        struct Simd_kernel<float> {
+            using Register = __m256;
+            static constexpr std::int64_t width = 8;
+
+            [[nodiscard]] static Register load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+            static void store(float* p, Register r) noexcept { _mm256_storeu_ps(p, r); }
+            [[nodiscard]] static Register broadcast(float value) noexcept { return _mm256_set1_ps(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm256_add_ps(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm256_sub_ps(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm256_mul_ps(a, b); }
+            [[nodiscard]] static Register div(Register a, Register b) noexcept { return _mm256_div_ps(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_NEQ_UQ)); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ)); }
+        };
+
+        template <>
+        struct Simd_kernel<double> {
+            using Register = __m256d;
+            static constexpr std::int64_t width = 4;
+
+            [[nodiscard]] static Register load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+            static void store(double* p, Register r) noexcept { _mm256_storeu_pd(p, r); }
+            [[nodiscard]] static Register broadcast(double value) noexcept { return _mm256_set1_pd(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm256_add_pd(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm256_sub_pd(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm256_mul_pd(a, b); }
+            [[nodiscard]] static Register div(Register a, Register b) noexcept { return _mm256_div_pd(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_NEQ_UQ)); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ)); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ)); }
+        };
+
+        template <>
+        struct Simd_kernel<std::int32_t> {
+            using Register = __m256i;
+            static constexpr std::int64_t width = 8;
+
+            [[nodiscard]] static Register load(const std::int32_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static void store(std::int32_t* p, Register r) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), r); }
+            [[nodiscard]] static Register broadcast(std::int32_t value) noexcept { return _mm256_set1_epi32(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm256_add_epi32(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm256_sub_epi32(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm256_mullo_epi32(a, b); }
+
+            [[nodiscard]] static Register bit_and(Register a, Register b) noexcept { return _mm256_and_si256(a, b); }
+            [[nodiscard]] static Register bit_or(Register a, Register b) noexcept { return _mm256_or_si256(a, b); }
+            [[nodiscard]] static Register bit_xor(Register a, Register b) noexcept { return _mm256_xor_si256(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return mask(_mm256_cmpeq_epi32(a, b)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return ~equal(a, b) & 0xFFu; }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return mask(_mm256_cmpgt_epi32(a, b)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return ~less(a, b) & 0xFFu; }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return mask(_mm256_cmpgt_epi32(b, a)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return ~greater(a, b) & 0xFFu; }
+
+        private:
+            [[nodiscard]] static std::uint32_t mask(Register r) noexcept { return _mm256_movemask_ps(_mm256_castsi256_ps(r)); }
+        };
+
+        template <>
+        struct Simd_kernel<std::int64_t> {
+            using Register = __m256i;
+            static constexpr std::int64_t width = 4;
+
+            [[nodiscard]] static Register load(const std::int64_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static void store(std::int64_t* p, Register r) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), r); }
+            [[nodiscard]] static Register broadcast(std::int64_t value) noexcept { return _mm256_set1_epi64x(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm256_add_epi64(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm256_sub_epi64(a, b); }
+
+            [[nodiscard]] static Register bit_and(Register a, Register b) noexcept { return _mm256_and_si256(a, b); }
+            [[nodiscard]] static Register bit_or(Register a, Register b) noexcept { return _mm256_or_si256(a, b); }
+            [[nodiscard]] static Register bit_xor(Register a, Register b) noexcept { return _mm256_xor_si256(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return mask(_mm256_cmpeq_epi64(a, b)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return ~equal(a, b) & 0xFu; }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return mask(_mm256_cmpgt_epi64(a, b)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return ~less(a, b) & 0xFu; }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return mask(_mm256_cmpgt_epi64(b, a)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return ~greater(a, b) & 0xFu; }
+
+        private:
+            [[nodiscard]] static std::uint32_t mask(Register r) noexcept { return _mm256_movemask_pd(_mm256_castsi256_pd(r)); }
+        };
+#elif defined(COMPUTOC_SIMD_SSE2)
+        template <>
+        struct Simd_kernel<float> {
+            using Register = __m128;
+            static constexpr std::int64_t width = 4;
+
+            [[nodiscard]] static Register load(const float* p) noexcept { return _mm_loadu_ps(p); }
+            static void store(float* p, Register r) noexcept { _mm_storeu_ps(p, r); }
+            [[nodiscard]] static Register broadcast(float value) noexcept { return _mm_set1_ps(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm_add_ps(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm_sub_ps(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm_mul_ps(a, b); }
+            [[nodiscard]] static Register div(Register a, Register b) noexcept { return _mm_div_ps(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm_movemask_ps(_mm_cmpneq_ps(a, b)); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm_movemask_ps(_mm_cmpge_ps(a, b)); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm_movemask_ps(_mm_cmple_ps(a, b)); }
+        };
+
+        template <>
+        struct Simd_kernel<double> {
+            using Register = __m128d;
+            static constexpr std::int64_t width = 2;
+
+            [[nodiscard]] static Register load(const double* p) noexcept { return _mm_loadu_pd(p); }
+            static void store(double* p, Register r) noexcept { _mm_storeu_pd(p, r); }
+            [[nodiscard]] static Register broadcast(double value) noexcept { return _mm_set1_pd(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm_add_pd(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm_sub_pd(a, b); }
+            [[nodiscard]] static Register mul(Register a, Register b) noexcept { return _mm_mul_pd(a, b); }
+            [[nodiscard]] static Register div(Register a, Register b) noexcept { return _mm_div_pd(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return _mm_movemask_pd(_mm_cmpneq_pd(a, b)); }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return _mm_movemask_pd(_mm_cmpgt_pd(a, b)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return _mm_movemask_pd(_mm_cmpge_pd(a, b)); }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return _mm_movemask_pd(_mm_cmplt_pd(a, b)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return _mm_movemask_pd(_mm_cmple_pd(a, b)); }
+        };
+
+        template <>
+        struct Simd_kernel<std::int32_t> {
+            using Register = __m128i;
+            static constexpr std::int64_t width = 4;
+
+            [[nodiscard]] static Register load(const std::int32_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store(std::int32_t* p, Register r) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), r); }
+            [[nodiscard]] static Register broadcast(std::int32_t value) noexcept { return _mm_set1_epi32(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm_add_epi32(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm_sub_epi32(a, b); }
+
+            [[nodiscard]] static Register bit_and(Register a, Register b) noexcept { return _mm_and_si128(a, b); }
+            [[nodiscard]] static Register bit_or(Register a, Register b) noexcept { return _mm_or_si128(a, b); }
+            [[nodiscard]] static Register bit_xor(Register a, Register b) noexcept { return _mm_xor_si128(a, b); }
+
+            [[nodiscard]] static std::uint32_t equal(Register a, Register b) noexcept { return mask(_mm_cmpeq_epi32(a, b)); }
+            [[nodiscard]] static std::uint32_t not_equal(Register a, Register b) noexcept { return ~equal(a, b) & 0xFu; }
+            [[nodiscard]] static std::uint32_t greater(Register a, Register b) noexcept { return mask(_mm_cmpgt_epi32(a, b)); }
+            [[nodiscard]] static std::uint32_t greater_equal(Register a, Register b) noexcept { return ~less(a, b) & 0xFu; }
+            [[nodiscard]] static std::uint32_t less(Register a, Register b) noexcept { return mask(_mm_cmplt_epi32(a, b)); }
+            [[nodiscard]] static std::uint32_t less_equal(Register a, Register b) noexcept { return ~greater(a, b) & 0xFu; }
+
+        private:
+            [[nodiscard]] static std::uint32_t mask(Register r) noexcept { return _mm_movemask_ps(_mm_castsi128_ps(r)); }
+        };
+
+        template <>
+        struct Simd_kernel<std::int64_t> {
+            using Register = __m128i;
+            static constexpr std::int64_t width = 2;
+
+            [[nodiscard]] static Register load(const std::int64_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store(std::int64_t* p, Register r) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), r); }
+            [[nodiscard]] static Register broadcast(std::int64_t value) noexcept { return _mm_set1_epi64x(value); }
+
+            [[nodiscard]] static Register add(Register a, Register b) noexcept { return _mm_add_epi64(a, b); }
+            [[nodiscard]] static Register sub(Register a, Register b) noexcept { return _mm_sub_epi64(a, b); }
+
+            [[nodiscard]] static Register bit_and(Register a, Register b) noexcept { return _mm_and_si128(a, b); }
+            [[nodiscard]] static Register bit_or(Register a, Register b) noexcept { return _mm_or_si128(a, b); }
+            [[nodiscard]] static Register bit_xor(Register a, Register b) noexcept { return _mm_xor_si128(a, b); }
+        };
+#endif
+
+        template <typename Binary_op>
+        struct Simd_op {};
+
+#define COMPUTOC_SIMD_OP(function_object, kernel_function) \
+        template <> \
+        struct Simd_op<function_object> { \
+            template <typename Kernel, typename Register> \
+            [[nodiscard]] static auto apply(Register a, Register b) noexcept -> decltype(Kernel::kernel_function(a, b)) \
+            { \
+                return Kernel::kernel_function(a, b); \
+            } \
+        };
+
+        COMPUTOC_SIMD_OP(std::plus<>, add)
+        COMPUTOC_SIMD_OP(std::minus<>, sub)
+        COMPUTOC_SIMD_OP(std::multiplies<>, mul)
+        COMPUTOC_SIMD_OP(std::divides<>, div)
+        COMPUTOC_SIMD_OP(std::bit_and<>, bit_and)
+        COMPUTOC_SIMD_OP(std::bit_or<>, bit_or)
+        COMPUTOC_SIMD_OP(std::bit_xor<>, bit_xor)
+        COMPUTOC_SIMD_OP(std::equal_to<>, equal)
+        COMPUTOC_SIMD_OP(std::not_equal_to<>, not_equal)
+        COMPUTOC_SIMD_OP(std::greater<>, greater)
+        COMPUTOC_SIMD_OP(std::greater_equal<>, greater_equal)
+        COMPUTOC_SIMD_OP(std::less<>, less)
+        COMPUTOC_SIMD_OP(std::less_equal<>, less_equal)
+
+#undef COMPUTOC_SIMD_OP
+
+        /**
+        * @note Transposes a square block in registers. The size rows of src, each size contiguous elements src_stride apart,
+        * are stored as the size columns of dst, whose rows are dst_stride apart.
+        */
+        template <typename T>
+        struct Simd_transpose_kernel {};
+
+#if defined(COMPUTOC_SIMD_AVX512) || defined(COMPUTOC_SIMD_AVX2)
+        template <>
+        struct Simd_transpose_kernel<float> {
+            static constexpr std::int64_t size = 8;
+
+            static void transpose(const float* src, std::int64_t src_stride, float* dst, std::int64_t dst_stride) noexcept
+            {
+                __m256 r0{ _mm256_loadu_ps(src) };
+                __m256 r1{ _mm256_loadu_ps(src + src_stride) };
+                __m256 r2{ _mm256_loadu_ps(src + 2 * src_stride) };
+                __m256 r3{ _mm256_loadu_ps(src + 3 * src_stride) };
+                __m256 r4{ _mm256_loadu_ps(src + 4 * src_stride) };
+                __m256 r5{ _mm256_loadu_ps(src + 5 * src_stride) };
+                __m256 r6{ _mm256_loadu_ps(src + 6 * src_stride) };
+                __m256 r7{ _mm256_loadu_ps(src + 7 * src_stride) };
+
+                __m256 t0{ _mm256_unpacklo_ps(r0, r1) };
+                __m256 t1{ _mm256_unpackhi_ps(r0, r1) };
+                __m256 t2{ _mm256_unpacklo_ps(r2, r3) };
+                __m256 t3{ _mm256_unpackhi_ps(r2, r3) };
+                __m256 t4{ _mm256_unpacklo_ps(r4, r5) };
+                __m256 t5{ _mm256_unpackhi_ps(r4, r5) };
+                __m256 t6{ _mm256_unpacklo_ps(r6, r7) };
+                __m256 t7{ _mm256_unpackhi_ps(r6, r7) };
+
+                r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+                r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+                r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+                r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+                r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+                _mm256_storeu_ps(dst, _mm256_permute2f128_ps(r0, r4, 0x20));
+                _mm256_storeu_ps(dst + dst_stride, _mm256_permute2f128_ps(r1, r5, 0x20));
+                _mm256_storeu_ps(dst + 2 * dst_stride, _mm256_permute2f128_ps(r2, r6, 0x20));
+                _mm256_storeu_ps(dst + 3 * dst_stride, _mm256_permute2f128_ps(r3, r7, 0x20));
+                _mm256_storeu_ps(dst + 4 * dst_stride, _mm256_permute2f128_ps(r0, r4, 0x31));
+                _mm256_storeu_ps(dst + 5 * dst_stride, _mm256_permute2f128_ps(r1, r5, 0x31));
+                _mm256_storeu_ps(dst + 6 * dst_stride, _mm256_permute2f128_ps(r2, r6, 0x31));
+                _mm256_storeu_ps(dst + 7 * dst_stride, _mm256_permute2f128_ps(r3, r7, 0x31));
             }
-            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>&& other)&
+        };
+
+        template <>
+        struct Simd_transpose_kernel<double> {
+            static constexpr std::int64_t size = 4;
+
+            static void transpose(const double* src, std::int64_t src_stride, double* dst, std::int64_t dst_stride) noexcept
             {
-                *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()));
-                copy(other, *this);
-                Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o> dummy{ std::move(other) };
-                return *this;
+                __m256d r0{ _mm256_loadu_pd(src) };
+                __m256d r1{ _mm256_loadu_pd(src + src_stride) };
+                __m256d r2{ _mm256_loadu_pd(src + 2 * src_stride) };
+                __m256d r3{ _mm256_loadu_pd(src + 3 * src_stride) };
+
+                __m256d t0{ _mm256_unpacklo_pd(r0, r1) };
+                __m256d t1{ _mm256_unpackhi_pd(r0, r1) };
+                __m256d t2{ _mm256_unpacklo_pd(r2, r3) };
+                __m256d t3{ _mm256_unpackhi_pd(r2, r3) };
+
+                _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd(dst + dst_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd(dst + 2 * dst_stride, _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd(dst + 3 * dst_stride, _mm256_permute2f128_pd(t1, t3, 0x31));
             }
-            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>&& other)&&
+        };
+#elif defined(COMPUTOC_SIMD_SSE2)
+        template <>
+        struct Simd_transpose_kernel<float> {
+            static constexpr std::int64_t size = 4;
+
+            static void transpose(const float* src, std::int64_t src_stride, float* dst, std::int64_t dst_stride) noexcept
             {
-                copy(other, *this);
-                Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o> dummy{ std::move(other) };
-                return *this;
+                __m128 r0{ _mm_loadu_ps(src) };
+                __m128 r1{ _mm_loadu_ps(src + src_stride) };
+                __m128 r2{ _mm_loadu_ps(src + 2 * src_stride) };
+                __m128 r3{ _mm_loadu_ps(src + 3 * src_stride) };
+
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(dst, r0);
+                _mm_storeu_ps(dst + dst_stride, r1);
+                _mm_storeu_ps(dst + 2 * dst_stride, r2);
+                _mm_storeu_ps(dst + 3 * dst_stride, r3);
             }
+        };
 
-            Array(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other) = default;
-            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
-            Array(const Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>& other)
-                : Array(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()))
+        template <>
+        struct Simd_transpose_kernel<double> {
+            static constexpr std::int64_t size = 2;
+
+            static void transpose(const double* src, std::int64_t src_stride, double* dst, std::int64_t dst_stride) noexcept
             {
-                copy(other, *this);
+                __m128d r0{ _mm_loadu_pd(src) };
+                __m128d r1{ _mm_loadu_pd(src + src_stride) };
+
+                _mm_storeu_pd(dst, _mm_unpacklo_pd(r0, r1));
+                _mm_storeu_pd(dst + dst_stride, _mm_unpackhi_pd(r0, r1));
             }
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other) & = default;
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other)&&
-            {
-                if (&other == this) {
-                    return *this;
+        };
+#endif
+
+        template <typename T>
+        concept Simd_transposable = requires { Simd_transpose_kernel<T>::size; };
+
+        /**
+        * @note Satisfied when the operation on two T values has a kernel producing T_o, where T_o is either T or a bool comparison result.
+        */
+        template <typename T>
+        concept Simd_vectorizable = requires { typename Simd_kernel<T>::Register; };
+
+        template <typename T, typename T_o, typename Binary_op>
+        concept Simd_binary_operation = Simd_vectorizable<T> && requires(typename Simd_kernel<T>::Register r) {
+            { Simd_op<std::remove_cvref_t<Binary_op>>::template apply<Simd_kernel<T>>(r, r) }
+                -> std::same_as<std::conditional_t<std::is_same_v<T_o, bool>, std::uint32_t, typename Simd_kernel<T>::Register>>;
+        };
+
+        /**
+        * @note Satisfied when applying an operation on a T value and a U scalar is equivalent to applying it on two T values.
+        */
+        template <typename T, typename U>
+        concept Simd_broadcastable = std::is_arithmetic_v<U> && std::is_same_v<std::common_type_t<T, U>, T>;
+
+        template <typename Kernel, typename Binary_op, typename T_o>
+        inline void simd_apply_and_store(typename Kernel::Register a, typename Kernel::Register b, T_o* res) noexcept
+        {
+            if constexpr (std::is_same_v<T_o, bool>) {
+                std::uint32_t mask{ Simd_op<Binary_op>::template apply<Kernel>(a, b) };
+                for (std::int64_t i = 0; i < Kernel::width; ++i) {
+                    res[i] = (mask >> i) & 1u;
                 }
+            }
+            else {
+                Kernel::store(res, Simd_op<Binary_op>::template apply<Kernel>(a, b));
+            }
+        }
 
-                copy(other, *this);
-                return *this;
+        /**
+        * @return Number of processed elements. The remaining elements should be processed by a scalar loop.
+        */
+        template <typename T, typename T_o, typename Binary_op>
+        requires Simd_binary_operation<T, T_o, Binary_op>
+        inline std::int64_t simd_transform(const T* lhs, const T* rhs, T_o* res, std::int64_t count, Binary_op&&) noexcept
+        {
+            using Kernel = Simd_kernel<T>;
+
+            std::int64_t i = 0;
+            for (; i + Kernel::width <= count; i += Kernel::width) {
+                simd_apply_and_store<Kernel, std::remove_cvref_t<Binary_op>>(Kernel::load(lhs + i), Kernel::load(rhs + i), res + i);
             }
-            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>& other)&
-            {
-                *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()));
-                copy(other, *this);
-                return *this;
+            return i;
+        }
+
+        /**
+        * @return Number of processed elements. The remaining elements should be processed by a scalar loop.
+        */
+        template <typename T, typename T_o, typename Binary_op>
+        requires Simd_binary_operation<T, T_o, Binary_op>
+        inline std::int64_t simd_transform(const T* lhs, const T& rhs, T_o* res, std::int64_t count, Binary_op&&) noexcept
+        {
+            using Kernel = Simd_kernel<T>;
+
+            const typename Kernel::Register rhs_reg{ Kernel::broadcast(rhs) };
+
+            std::int64_t i = 0;
+            for (; i + Kernel::width <= count; i += Kernel::width) {
+                simd_apply_and_store<Kernel, std::remove_cvref_t<Binary_op>>(Kernel::load(lhs + i), rhs_reg, res + i);
             }
-            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>& other)&&
-            {
-                copy(other, *this);
-                return *this;
+            return i;
+        }
+
+        /**
+        * @return Number of processed elements. The remaining elements should be processed by a scalar loop.
+        */
+        template <typename T, typename T_o, typename Binary_op>
+        requires Simd_binary_operation<T, T_o, Binary_op>
+        inline std::int64_t simd_transform(const T& lhs, const T* rhs, T_o* res, std::int64_t count, Binary_op&&) noexcept
+        {
+            using Kernel = Simd_kernel<T>;
+
+            const typename Kernel::Register lhs_reg{ Kernel::broadcast(lhs) };
+
+            std::int64_t i = 0;
+            for (; i + Kernel::width <= count; i += Kernel::width) {
+                simd_apply_and_store<Kernel, std::remove_cvref_t<Binary_op>>(lhs_reg, Kernel::load(rhs + i), res + i);
             }
+            return i;
+        }
 
-            template <typename U>
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const U& value)
-            {
-                if (empty(*this)) {
-                    return *this;
-                }
+        /**
+        * @param[in] begin,end Range of positions to process, as if the result array was dense.
+        * @note All headers should have the same dimensions. Rows are processed at once, and strides of the operands may be zero for broadcast dimensions.
+        */
+        template <typename T1, typename T2, typename T_o, typename Binary_op, std::int64_t Dims_capacity, template<typename> typename Internal_allocator>
+        inline void broadcast_transform(
+            const T1* lhs, const Array_header<Dims_capacity, Internal_allocator>& lhs_hdr,
+            const T2* rhs, const Array_header<Dims_capacity, Internal_allocator>& rhs_hdr,
+            T_o* res, const Array_header<Dims_capacity, Internal_allocator>& res_hdr,
+            std::int64_t begin, std::int64_t end, Binary_op&& op)
+        {
+            const std::int64_t ndims{ std::ssize(res_hdr.dims()) };
+            if (ndims <= 0 || begin >= end) {
+                return;
+            }
 
-                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(hdr_); gen; ++gen) {
-                    (*this)(*gen) = value;
+            std::span<const std::int64_t> dims{ res_hdr.dims() };
+            std::span<const std::int64_t> lhs_strides{ lhs_hdr.strides() };
+            std::span<const std::int64_t> rhs_strides{ rhs_hdr.strides() };
+            std::span<const std::int64_t> res_strides{ res_hdr.strides() };
+
+            const std::int64_t row_size{ dims[ndims - 1] };
+            const std::int64_t lhs_step{ lhs_strides[ndims - 1] };
+            const std::int64_t rhs_step{ rhs_strides[ndims - 1] };
+            const std::int64_t res_step{ res_strides[ndims - 1] };
+
+            simple_dims_vector<Dims_capacity, Internal_allocator> counters(ndims);
+
+            std::int64_t lhs_row_ind{ lhs_hdr.offset() };
+            std::int64_t rhs_row_ind{ rhs_hdr.offset() };
+            std::int64_t res_row_ind{ res_hdr.offset() };
+
+            std::int64_t row{ begin / row_size };
+            for (std::int64_t i = ndims - 2; i >= 0; --i) {
+                counters[i] = row % dims[i];
+                row /= dims[i];
+                lhs_row_ind += counters[i] * lhs_strides[i];
+                rhs_row_ind += counters[i] * rhs_strides[i];
+                res_row_ind += counters[i] * res_strides[i];
+            }
+
+            std::int64_t first{ begin % row_size };
+            for (std::int64_t remaining{ end - begin }; remaining > 0;) {
+                const std::int64_t count{ std::min(row_size - first, remaining) };
+
+                const T1* lhs_row{ lhs + lhs_row_ind + first * lhs_step };
+                const T2* rhs_row{ rhs + rhs_row_ind + first * rhs_step };
+                T_o* res_row{ res + res_row_ind + first * res_step };
+
+                std::int64_t j = 0;
+                if constexpr (std::is_same_v<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                    if (res_step == 1 && lhs_step == 1 && rhs_step == 1) {
+                        j = simd_transform(lhs_row, rhs_row, res_row, count, op);
+                    }
+                    else if (res_step == 1 && lhs_step == 1 && rhs_step == 0) {
+                        j = simd_transform(lhs_row, *rhs_row, res_row, count, op);
+                    }
+                    else if (res_step == 1 && lhs_step == 0 && rhs_step == 1) {
+                        j = simd_transform(*lhs_row, rhs_row, res_row, count, op);
+                    }
+                }
+                for (; j < count; ++j) {
+                    res_row[j * res_step] = op(lhs_row[j * lhs_step], rhs_row[j * rhs_step]);
                 }
 
-                return *this;
+                remaining -= count;
+                first = 0;
+
+                for (std::int64_t i = ndims - 2; i >= 0; --i) {
+                    ++counters[i];
+                    lhs_row_ind += lhs_strides[i];
+                    rhs_row_ind += rhs_strides[i];
+                    res_row_ind += res_strides[i];
+                    if (counters[i] < dims[i]) {
+                        break;
+                    }
+                    counters[i] = 0;
+                    lhs_row_ind -= dims[i] * lhs_strides[i];
+                    rhs_row_ind -= dims[i] * rhs_strides[i];
+                    res_row_ind -= dims[i] * res_strides[i];
+                }
             }
+        }
 
-            virtual ~Array() = default;
 
-            Array(std::span<const std::int64_t> dims, const T* data = nullptr)
-                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator<simple_vector<T, Data_capacity, Data_allocator>>(), hdr_.count()))
-            {
-                if (data) {
-                    std::copy(data, data + hdr_.count(), buffsp_->data());
+
+
+        /**
+        * @note Copies the elements of the header view into the dense destination, one run of the generator at a time.
+        */
+        template <typename T, typename T_o, std::int64_t Dims_capacity, template<typename> typename Internal_allocator>
+        inline void copy_runs(const T* src, const Array_header<Dims_capacity, Internal_allocator>& src_hdr, T_o* dst)
+        {
+            for (Array_indices_generator<Dims_capacity, Internal_allocator> gen(src_hdr); gen; gen.next_run()) {
+                const T* run_ptr{ src + *gen };
+                const std::int64_t run_stride{ gen.run_stride() };
+                const std::int64_t run_length{ gen.run_length() };
+                if (run_stride == 1) {
+                    std::copy_n(run_ptr, run_length, dst);
                 }
+                else {
+                    for (std::int64_t i = 0; i < run_length; ++i) {
+                        dst[i] = run_ptr[i * run_stride];
+                    }
+                }
+                dst += run_length;
             }
-            Array(std::span<const std::int64_t> dims, std::initializer_list<T> data)
-                : Array(dims, data.begin())
-            {
+        }
+
+        /**
+        * @note Copies the elements of the header view into slabs of slab_count consecutive elements of the destination,
+        * whose first elements are dst_stride elements apart.
+        */
+        template <typename T, typename T_o, std::int64_t Dims_capacity, template<typename> typename Internal_allocator>
+        inline void copy_slabs(const T* src, const Array_header<Dims_capacity, Internal_allocator>& src_hdr, std::int64_t slab_count, T_o* dst, std::int64_t dst_stride)
+        {
+            if (!src_hdr.is_subarray()) {
+                for (std::int64_t i = 0; i < src_hdr.count(); i += slab_count, dst += dst_stride) {
+                    std::copy_n(src + i, slab_count, dst);
+                }
+                return;
             }
-            Array(std::initializer_list<std::int64_t> dims, const T* data = nullptr)
-                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data)
-            {
+
+            std::int64_t slab_ind{ 0 };
+            for (Array_indices_generator<Dims_capacity, Internal_allocator> gen(src_hdr); gen; gen.next_run()) {
+                const T* run_ptr{ src + *gen };
+                const std::int64_t run_stride{ gen.run_stride() };
+                const std::int64_t run_length{ gen.run_length() };
+                for (std::int64_t i = 0; i < run_length;) {
+                    const std::int64_t length{ std::min(run_length - i, slab_count - slab_ind) };
+                    if (run_stride == 1) {
+                        std::copy_n(run_ptr + i, length, dst + slab_ind);
+                    }
+                    else {
+                        for (std::int64_t j = 0; j < length; ++j) {
+                            dst[slab_ind + j] = run_ptr[(i + j) * run_stride];
+                        }
+                    }
+                    i += length;
+                    slab_ind += length;
+                    if (slab_ind == slab_count) {
+                        slab_ind = 0;
+                        dst += dst_stride;
+                    }
+                }
             }
-            Array(std::initializer_list<std::int64_t> dims, std::initializer_list<T> data)
-                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data.begin())
-            {
+        }
+
+        /*
+        * Parallel execution:
+        * ===================
+        *
+        * Algorithms called with an execution policy split the elements into chunks of consecutive positions,
+        * and process the chunks by the threads of a thread pool. Partial results are combined in chunk order.
+        */
+
+        class Thread_pool final {
+        public:
+            explicit Thread_pool(std::int64_t num_threads = std::max<std::int64_t>(std::thread::hardware_concurrency(), 1))
+            {
+                for (std::int64_t i = 0; i < num_threads; ++i) {
+                    workers_.emplace_back([this]() {
+                        for (;;) {
+                            std::function<void()> task;
+                            {
+                                std::unique_lock lock(mutex_);
+                                cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+                                if (stop_ && tasks_.empty()) {
+                                    return;
+                                }
+                                task = std::move(tasks_.front());
+                                tasks_.pop_front();
+                            }
+                            task();
+                        }
+                    });
+                }
             }
-            template <typename U>
-            Array(std::span<const std::int64_t> dims, const U* data = nullptr)
-                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator < simple_vector<T, Data_capacity, Data_allocator>>(), hdr_.count()))
+
+            Thread_pool(const Thread_pool&) = delete;
+            Thread_pool& operator=(const Thread_pool&) = delete;
+
+            ~Thread_pool()
             {
-                std::copy(data, data + hdr_.count(), buffsp_->data());
+                {
+                    std::scoped_lock lock(mutex_);
+                    stop_ = true;
+                }
+                cv_.notify_all();
+                for (std::thread& worker : workers_) {
+                    worker.join();
+                }
             }
-            template <typename U>
-            Array(std::span<const std::int64_t> dims, std::initializer_list<U> data)
-                : Array(dims, data.begin())
+
+            [[nodiscard]] std::int64_t size() const noexcept
             {
+                return std::ssize(workers_);
             }
-            template <typename U>
-            Array(std::initializer_list<std::int64_t> dims, const U* data = nullptr)
-                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data)
+
+            /**
+            * @brief Calls func(begin, end) for consecutive chunks of [0, count) and waits for all of them to complete.
+            * @note The calling thread executes pending tasks while waiting, so nested calls do not deadlock. The first exception thrown by func is rethrown.
+            */
+            template <typename Chunk_func>
+            void parallel_for(std::int64_t count, std::int64_t min_chunk_size, Chunk_func&& func)
             {
-            }
-            template <typename U>
-            Array(std::initializer_list<std::int64_t> dims, std::initializer_list<U> data = nullptr)
-                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data.begin())
+                if (count <= 0) {
+                    return;
+                }
+
+                const std::int64_t num_chunks{ std::clamp<std::int64_t>(count / std::max<std::int64_t>(min_chunk_size, 1), 1, std::max<std::int64_t>(size(), 1)) };
+                if (num_chunks == 1) {
+                    func(std::int64_t{ 0 }, count);
+                    return;
+                }
+
+                // shared with the tasks, since a worker may still be inside count_down when the caller returns
+                struct Completion {
+                    explicit Completion(std::int64_t num_chunks)
+                        : done(num_chunks)
+                    {
+                    }
+
+                    std::latch done;
+                    std::exception_ptr error{ nullptr };
+                    std::mutex error_mutex;
+                };
+                std::shared_ptr<Completion> completion{ std::make_shared<Completion>(num_chunks) };
+
+                {
+                    std::scoped_lock lock(mutex_);
+                    for (std::int64_t i = 0; i < num_chunks; ++i) {
+                        const std::int64_t begin{ count * i / num_chunks };
+                        const std::int64_t end{ count * (i + 1) / num_chunks };
+                        tasks_.emplace_back([&func, completion, begin, end]() {
+                            try {
+                                func(begin, end);
+                            }
+                            catch (...) {
+                                std::scoped_lock lock(completion->error_mutex);
+                                if (!completion->error) {
+                                    completion->error = std::current_exception();
+                                }
+                            }
+                            completion->done.count_down();
+                        });
+                    }
+                }
+                cv_.notify_all();
+
+                while (!completion->done.try_wait()) {
+                    std::function<void()> task;
+                    {
+                        std::scoped_lock lock(mutex_);
+                        if (!tasks_.empty()) {
+                            task = std::move(tasks_.front());
+                            tasks_.pop_front();
+                        }
+                    }
+                    if (!task) {
+                        completion->done.wait();
+                        break;
+                    }
+                    task();
+                }
+
+                if (completion->error) {
+                    std::rethrow_exception(completion->error);
+                }
+            }
+
+        private:
+            std::vector<std::thread> workers_;
+            std::deque<std::function<void()>> tasks_;
+            std::mutex mutex_;
+            std::condition_variable cv_;
+            bool stop_{ false };
+        };
+
+        [[nodiscard]] inline Thread_pool& default_thread_pool()
+        {
+            static Thread_pool pool;
+            return pool;
+        }
+
+        struct Parallel_execution_policy {
+            Thread_pool* pool{ nullptr }; // default_thread_pool() if null
+            std::int64_t min_chunk_size{ 32768 };
+
+            [[nodiscard]] Thread_pool& thread_pool() const
             {
+                return pool ? *pool : default_thread_pool();
             }
+        };
 
+        inline constexpr Parallel_execution_policy par{};
 
-            Array(std::span<const std::int64_t> dims, const T& value)
-                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator < simple_vector<T, Data_capacity, Data_allocator>>(), hdr_.count()))
+
+        template <typename Binary_op>
+        inline constexpr bool is_associative_operation_v =
+            std::is_same_v<Binary_op, std::plus<>> || std::is_same_v<Binary_op, std::multiplies<>> ||
+            std::is_same_v<Binary_op, std::bit_and<>> || std::is_same_v<Binary_op, std::bit_or<>> || std::is_same_v<Binary_op, std::bit_xor<>>;
+
+        /**
+        * @note Vector lanes are combined out of the sequential order, which might change the rounding of floating point results.
+        */
+        template <typename T, typename Binary_op>
+        requires (Simd_binary_operation<T, T, Binary_op> && is_associative_operation_v<std::remove_cvref_t<Binary_op>>)
+        [[nodiscard]] inline T simd_reduce(const T* data, std::int64_t count, Binary_op&& op) noexcept
+        {
+            using Kernel = Simd_kernel<T>;
+
+            std::int64_t i = 0;
+            T res{};
+
+            if (count >= 2 * Kernel::width) {
+                typename Kernel::Register acc{ Kernel::load(data) };
+                for (i = Kernel::width; i + Kernel::width <= count; i += Kernel::width) {
+                    acc = Simd_op<std::remove_cvref_t<Binary_op>>::template apply<Kernel>(acc, Kernel::load(data + i));
+                }
+
+                T lanes[Kernel::width];
+                Kernel::store(lanes, acc);
+                res = lanes[0];
+                for (std::int64_t j = 1; j < Kernel::width; ++j) {
+                    res = op(res, lanes[j]);
+                }
+            }
+            else {
+                res = data[0];
+                i = 1;
+            }
+
+            for (; i < count; ++i) {
+                res = op(res, data[i]);
+            }
+            return res;
+        }
+
+        inline constexpr std::int64_t reduction_block_size{ 2048 };
+
+        /**
+        * @brief Reduces the middle dimension of a dense buffer viewed as outer x count x inner elements.
+        * @param[out] dst An already allocated dense buffer of outer x inner elements.
+        * @param policy Parallel execution policy, or null for a sequential reduction.
+        * @note Reductions of the innermost dimension combine whole contiguous slices. Other reductions accumulate
+        * whole contiguous rows of at most reduction_block_size elements into the output.
+        */
+        template <typename T, typename T_o, typename Binary_op>
+        inline void reduce_dense_axis(const T* src, T_o* dst, std::int64_t outer, std::int64_t count, std::int64_t inner, Binary_op& op, const Parallel_execution_policy* policy)
+        {
+            auto run = [policy](std::int64_t num_items, std::int64_t item_size, auto&& func) {
+                if (!policy) {
+                    func(std::int64_t{ 0 }, num_items);
+                    return;
+                }
+                policy->thread_pool().parallel_for(num_items, std::max<std::int64_t>(policy->min_chunk_size / std::max<std::int64_t>(item_size, 1), 1), func);
+            };
+
+            if (inner == 1) {
+                run(outer, count, [&](std::int64_t begin, std::int64_t end) {
+                    for (std::int64_t o = begin; o < end; ++o) {
+                        const T* slice{ src + o * count };
+                        if constexpr (std::is_same_v<T, T_o> && requires { simd_reduce(slice, count, op); }) {
+                            dst[o] = simd_reduce(slice, count, op);
+                        }
+                        else {
+                            T_o res{ static_cast<T_o>(slice[0]) };
+                            for (std::int64_t k = 1; k < count; ++k) {
+                                res = op(res, slice[k]);
+                            }
+                            dst[o] = res;
+                        }
+                    }
+                });
+                return;
+            }
+
+            const std::int64_t num_blocks{ (inner + reduction_block_size - 1) / reduction_block_size };
+
+            run(outer * num_blocks, count * std::min(inner, reduction_block_size), [&](std::int64_t begin, std::int64_t end) {
+                for (std::int64_t item = begin; item < end; ++item) {
+                    const std::int64_t o{ item / num_blocks };
+                    const std::int64_t first{ (item % num_blocks) * reduction_block_size };
+                    const std::int64_t last{ std::min(first + reduction_block_size, inner) };
+
+                    const T* slice{ src + o * count * inner };
+                    T_o* row{ dst + o * inner };
+
+                    for (std::int64_t j = first; j < last; ++j) {
+                        row[j] = static_cast<T_o>(slice[j]);
+                    }
+
+                    for (std::int64_t k = 1; k < count; ++k) {
+                        const T* slice_row{ slice + k * inner };
+                        std::int64_t j = first;
+                        if constexpr (std::is_same_v<T, T_o> && Simd_binary_operation<T, T, Binary_op>) {
+                            j += simd_transform(row + first, slice_row + first, row + first, last - first, op);
+                        }
+                        for (; j < last; ++j) {
+                            row[j] = op(row[j], slice_row[j]);
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+        * @note Blocks of transpose_block_size x transpose_block_size elements, of which a source and a destination block
+        * of doubles fit together in a 32KB L1 data cache.
+        */
+        inline constexpr std::int64_t transpose_block_size{ 32 };
+
+        /**
+        * @brief Copies a strided source into a dense destination, where destination axis k reads source axis order[k].
+        * @param policy Parallel execution policy, or null for a sequential copy.
+        * @note When the source axis with the smallest stride is not the destination innermost axis, each 2-D plane of
+        * these two axes is copied by square blocks, so that both sides of the copy are read and written along cache lines.
+        */
+        template <typename T, std::int64_t Dims_capacity, template<typename> typename Internal_allocator>
+        inline void transpose_copy(const T* src, const Array_header<Dims_capacity, Internal_allocator>& src_hdr, std::span<const std::int64_t> order, T* dst, const Array_header<Dims_capacity, Internal_allocator>& dst_hdr, const Parallel_execution_policy* policy)
+        {
+            const std::int64_t ndims{ std::ssize(dst_hdr.dims()) };
+            std::span<const std::int64_t> dims{ dst_hdr.dims() };
+            std::span<const std::int64_t> dst_strides{ dst_hdr.strides() };
+
+            simple_dims_vector<Dims_capacity, Internal_allocator> src_strides(ndims);
+            for (std::int64_t k = 0; k < ndims; ++k) {
+                src_strides[k] = src_hdr.strides()[modulo(order[k], ndims)];
+            }
+
+            std::int64_t row_axis{ ndims - 1 };
+            for (std::int64_t k = 0; k < ndims; ++k) {
+                if (dims[k] > 1 && std::abs(src_strides[k]) < std::abs(src_strides[row_axis])) {
+                    row_axis = k;
+                }
+            }
+
+            if (row_axis == ndims - 1 || dims[ndims - 1] == 1) {
+                for (Array_indices_generator<Dims_capacity, Internal_allocator> gen(src_hdr, order); gen; gen.next_run()) {
+                    const T* run_ptr{ src + *gen };
+                    const std::int64_t run_stride{ gen.run_stride() };
+                    const std::int64_t run_length{ gen.run_length() };
+                    for (std::int64_t i = 0; i < run_length; ++i) {
+                        dst[i] = run_ptr[i * run_stride];
+                    }
+                    dst += run_length;
+                }
+                return;
+            }
+
+            const std::int64_t col_axis{ ndims - 1 };
+            const std::int64_t num_rows{ dims[row_axis] };
+            const std::int64_t num_cols{ dims[col_axis] };
+            const std::int64_t src_row_stride{ src_strides[row_axis] };
+            const std::int64_t src_col_stride{ src_strides[col_axis] };
+            const std::int64_t dst_row_stride{ dst_strides[row_axis] };
+
+            const std::int64_t row_blocks{ (num_rows + transpose_block_size - 1) / transpose_block_size };
+            const std::int64_t col_blocks{ (num_cols + transpose_block_size - 1) / transpose_block_size };
+            const std::int64_t num_planes{ dst_hdr.count() / (num_rows * num_cols) };
+
+            auto copy_blocks = [&](std::int64_t begin, std::int64_t end) {
+                for (std::int64_t block = begin; block < end; ++block) {
+                    std::int64_t plane{ block / (row_blocks * col_blocks) };
+                    const std::int64_t i0{ ((block / col_blocks) % row_blocks) * transpose_block_size };
+                    const std::int64_t j0{ (block % col_blocks) * transpose_block_size };
+                    const std::int64_t i1{ std::min(i0 + transpose_block_size, num_rows) };
+                    const std::int64_t j1{ std::min(j0 + transpose_block_size, num_cols) };
+
+                    const T* src_plane{ src + src_hdr.offset() };
+                    T* dst_plane{ dst };
+                    for (std::int64_t k = ndims - 2; k >= 0; --k) {
+                        if (k != row_axis) {
+                            src_plane += (plane % dims[k]) * src_strides[k];
+                            dst_plane += (plane % dims[k]) * dst_strides[k];
+                            plane /= dims[k];
+                        }
+                    }
+
+                    std::int64_t i = i0;
+                    if constexpr (Simd_transposable<T>) {
+                        using Kernel = Simd_transpose_kernel<T>;
+                        if (src_row_stride == 1) {
+                            for (; i + Kernel::size <= i1; i += Kernel::size) {
+                                std::int64_t j = j0;
+                                for (; j + Kernel::size <= j1; j += Kernel::size) {
+                                    Kernel::transpose(src_plane + i + j * src_col_stride, src_col_stride, dst_plane + i * dst_row_stride + j, dst_row_stride);
+                                }
+                                for (std::int64_t ii = i; ii < i + Kernel::size; ++ii) {
+                                    for (std::int64_t jj = j; jj < j1; ++jj) {
+                                        dst_plane[ii * dst_row_stride + jj] = src_plane[ii + jj * src_col_stride];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    for (; i < i1; ++i) {
+                        for (std::int64_t j = j0; j < j1; ++j) {
+                            dst_plane[i * dst_row_stride + j] = src_plane[i * src_row_stride + j * src_col_stride];
+                        }
+                    }
+                }
+            };
+
+            const std::int64_t num_blocks{ num_planes * row_blocks * col_blocks };
+            if (!policy) {
+                copy_blocks(0, num_blocks);
+                return;
+            }
+            policy->thread_pool().parallel_for(num_blocks, std::max<std::int64_t>(policy->min_chunk_size / (transpose_block_size * transpose_block_size), 1), copy_blocks);
+        }
+
+
+        /*
+        * Lazy expressions:
+        * =================
+        *
+        * Arrays wrapped by lazy() can be combined by element-wise operators and math functions into expression nodes.
+        * No memory is allocated and no element is computed until the expression is assigned to an array or passed to
+        * reduce or to all_match, all_equal or all_close, in which case all the operations are performed in a single pass.
+        */
+
+        struct Lazy_expression_tag {};
+
+        template <typename T>
+        concept Lazy_expression = std::is_base_of_v<Lazy_expression_tag, std::remove_cvref_t<T>>;
+
+
+        template <typename T, std::int64_t Data_capacity = dynamic_sequence, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        class Array {
+        public:
+            using Header = Array_header<Dims_capacity, Internals_allocator>;
+
+            Array() = default;
+
+            Array(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& other) = default;
+            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
+            Array(Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>&& other)
+                : Array(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()), uninitialized)
             {
-                std::fill(buffsp_->data(), buffsp_->data() + buffsp_->size(), value);
+                copy(other, *this);
+
+                Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o> dummy{ std::move(other) };
             }
-            Array(std::initializer_list<std::int64_t> dims, const T& value)
-                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, value)
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& other) & = default;
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& other)&&
             {
+                if (&other == this) {
+                    return *this;
+                }
+
+                copy(other, *this);
+                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dummy{ std::move(other) };
+                return *this;
             }
-            template <typename U>
-            Array(std::span<const std::int64_t> dims, const U& value)
-                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator < simple_vector<T, Data_capacity, Data_allocator>>(), hdr_.count()))
+            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>&& other)&
             {
-                std::fill(buffsp_->data(), buffsp_->data() + buffsp_->size(), value);
+                *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()), uninitialized);
+                copy(other, *this);
+                Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o> dummy{ std::move(other) };
+                return *this;
             }
-            template <typename U>
-            Array(std::initializer_list<std::int64_t> dims, const U& value)
-                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, value)
+            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>&& other)&&
             {
+                copy(other, *this);
+                Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o> dummy{ std::move(other) };
+                return *this;
             }
 
-            [[nodiscard]] const Header& header() const noexcept
+            Array(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other) = default;
+            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
+            Array(const Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>& other)
+                : Array(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()), uninitialized)
             {
-                return hdr_;
+                copy(other, *this);
             }
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other) & = default;
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other)&&
+            {
+                if (&other == this) {
+                    return *this;
+                }
 
-            [[nodiscard]] Header& header() noexcept
+                copy(other, *this);
+                return *this;
+            }
+            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>& other)&
             {
-                return hdr_;
+                *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(other.header().dims().data(), other.header().dims().size()), uninitialized);
+                copy(other, *this);
+                return *this;
+            }
+            template< typename T_o, std::int64_t Data_capacity_o, std::int64_t Dims_capacity_o, template<typename> typename Data_allocator_o, template<typename> typename Internals_allocator_o>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Array<T_o, Data_capacity_o, Dims_capacity_o, Data_allocator_o, Internals_allocator_o>& other)&&
+            {
+                copy(other, *this);
+                return *this;
             }
 
-            [[nodiscard]] T* data() const noexcept
+            template <typename U>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const U& value)
             {
-                return buffsp_ ? buffsp_->data() : nullptr;
+                if (empty(*this)) {
+                    return *this;
+                }
+
+                detach_on_write();
+
+                if (!hdr_.is_subarray()) {
+                    std::fill(buffsp_->data(), buffsp_->data() + hdr_.count(), value);
+                    return *this;
+                }
+
+                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(hdr_); gen; gen.next_run()) {
+                    T* run_ptr{ buffsp_->data() + *gen };
+                    const std::int64_t run_stride{ gen.run_stride() };
+                    for (std::int64_t i = 0; i < gen.run_length(); ++i) {
+                        run_ptr[i * run_stride] = value;
+                    }
+                }
+
+                return *this;
             }
 
-            [[nodiscard]] const T& operator()(std::int64_t index) const noexcept
+            template <Lazy_expression Expression>
+            explicit Array(const Expression& expr)
+                : Array(expr.is_valid() ? expr.dims() : std::span<const std::int64_t>{}, uninitialized)
             {
-                return buffsp_->data()[modulo(index, hdr_.last_index() + 1)];
+                T* data_ptr{ data() };
+                for (std::int64_t i = 0; i < hdr_.count(); ++i) {
+                    data_ptr[i] = static_cast<T>(expr[i]);
+                }
             }
-            [[nodiscard]] T& operator()(std::int64_t index) noexcept
+            /**
+            * @note The expression is evaluated into the current buffer only if its dimensions are equal to the array dimensions
+            * and no other array shares the buffer, so that the operands cannot alias the written elements. Otherwise, as with
+            * the assignment of an array, the array is rebound to a new buffer holding the result.
+            */
+            template <Lazy_expression Expression>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Expression& expr)&
             {
-                return buffsp_->data()[modulo(index, hdr_.last_index() + 1)];
+                if (!expr.is_valid() || buffsp_.use_count() != 1 || !std::equal(hdr_.dims().begin(), hdr_.dims().end(), expr.dims().begin(), expr.dims().end())) {
+                    *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(expr);
+                    return *this;
+                }
+
+                if (!hdr_.is_subarray()) {
+                    T* data_ptr{ data() };
+                    for (std::int64_t i = 0; i < hdr_.count(); ++i) {
+                        data_ptr[i] = static_cast<T>(expr[i]);
+                    }
+                    return *this;
+                }
+
+                std::int64_t i = 0;
+                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(hdr_); gen; ++gen, ++i) {
+                    (*this)(*gen) = static_cast<T>(expr[i]);
+                }
+
+                return *this;
+            }
+            /**
+            * @note Writes the result into the viewed elements, as the assignment of an array to a temporary does.
+            * The expression is evaluated before writing, since its operands may view the same elements.
+            */
+            template <Lazy_expression Expression>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& operator=(const Expression& expr)&&
+            {
+                copy(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(expr), *this);
+                return *this;
+            }
+
+            virtual ~Array() = default;
+
+            Array(std::span<const std::int64_t> dims, const T* data = nullptr)
+                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator<simple_vector<T, Data_capacity, Data_allocator>>(), hdr_.count()))
+            {
+                if (data) {
+                    std::copy(data, data + hdr_.count(), buffsp_->data());
+                }
+            }
+            /**
+            * @note The elements are left uninitialized when possible, and must all be assigned before being read.
+            */
+            Array(std::span<const std::int64_t> dims, Uninitialized_tag)
+                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator<simple_vector<T, Data_capacity, Data_allocator>>(), hdr_.count(), uninitialized))
+            {
+            }
+            Array(std::initializer_list<std::int64_t> dims, Uninitialized_tag)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, uninitialized)
+            {
+            }
+            Array(std::span<const std::int64_t> dims, std::initializer_list<T> data)
+                : Array(dims, data.begin())
+            {
+            }
+            Array(std::initializer_list<std::int64_t> dims, const T* data = nullptr)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data)
+            {
+            }
+            Array(std::initializer_list<std::int64_t> dims, std::initializer_list<T> data)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data.begin())
+            {
+            }
+            template <typename U>
+            Array(std::span<const std::int64_t> dims, const U* data = nullptr)
+                : Array(dims, uninitialized)
+            {
+                std::copy(data, data + hdr_.count(), buffsp_->data());
+            }
+            template <typename U>
+            Array(std::span<const std::int64_t> dims, std::initializer_list<U> data)
+                : Array(dims, data.begin())
+            {
+            }
+            template <typename U>
+            Array(std::initializer_list<std::int64_t> dims, const U* data = nullptr)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data)
+            {
+            }
+            template <typename U>
+            Array(std::initializer_list<std::int64_t> dims, std::initializer_list<U> data = nullptr)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, data.begin())
+            {
+            }
+
+
+            Array(std::span<const std::int64_t> dims, const T& value)
+                : Array(dims, uninitialized)
+            {
+                std::fill(buffsp_->data(), buffsp_->data() + buffsp_->size(), value);
+            }
+            Array(std::initializer_list<std::int64_t> dims, const T& value)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, value)
+            {
+            }
+            template <typename U>
+            Array(std::span<const std::int64_t> dims, const U& value)
+                : Array(dims, uninitialized)
+            {
+                std::fill(buffsp_->data(), buffsp_->data() + buffsp_->size(), value);
+            }
+            template <typename U>
+            Array(std::initializer_list<std::int64_t> dims, const U& value)
+                : Array(std::span<const std::int64_t>{dims.begin(), dims.size()}, value)
+            {
+            }
+
+            /**
+            * @note The array uses the external data as its buffer without copying it, and release is called with the data
+            * and its number of elements when the last array sharing the buffer is destroyed.
+            */
+            Array(std::span<const std::int64_t> dims, T* external_data, std::function<void(T*, std::int64_t)> release) requires (Data_capacity == dynamic_sequence)
+                : hdr_(dims), buffsp_(std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator<simple_vector<T, Data_capacity, Data_allocator>>(), external_data, hdr_.count(), std::move(release)))
+            {
+            }
+
+            /**
+            * @note The array views the buffer of other through a buffer of its own, which is shared by its copies and
+            * subarrays like any other buffer. The first access through a non-const accessor of any of them (data, element
+            * and subarray operators, member transform and assignments, iterators, in place appends) copies the elements
+            * into that buffer, or only the viewed elements if no other array shares it. Likewise, the first such access
+            * through other or the arrays sharing its buffer hands the current elements over to the clone before writing,
+            * so that the clone is not affected by later writes. Writes through a pointer taken from a const array are not tracked.
+            * Arrays of static data capacity are copied right away.
+            */
+            Array(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other, Copy_on_write_tag)
+                : hdr_(other.hdr_)
+            {
+                if (!other.buffsp_) {
+                    return;
+                }
+
+                if constexpr (Data_capacity == dynamic_sequence) {
+                    buffsp_ = std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator<simple_vector<T, Data_capacity, Data_allocator>>(), other.buffsp_);
+                }
+                else {
+                    buffsp_ = std::allocate_shared<simple_vector<T, Data_capacity, Data_allocator>>(Internals_allocator<simple_vector<T, Data_capacity, Data_allocator>>(), *other.buffsp_);
+                }
+            }
+
+            [[nodiscard]] bool is_copy_on_write() const noexcept
+            {
+                return buffsp_ && buffsp_->is_copy_on_write();
+            }
+
+            /**
+            * @note Returns true if the array is dense and the only owner of its allocated buffer, such that operations over an
+            * expiring array can write their results into its buffer.
+            */
+            [[nodiscard]] bool is_reusable() const noexcept
+            {
+                return buffsp_ && buffsp_.use_count() == 1 && !hdr_.is_subarray() && !buffsp_->is_external() && !buffsp_->is_copy_on_write() && !buffsp_->is_viewed();
+            }
+
+            /**
+            * @note Returns the release function of the external buffer viewed by the array if it is of type Func, or nullptr otherwise.
+            */
+            template <typename Func>
+            [[nodiscard]] const Func* release_target() const noexcept
+            {
+                return buffsp_ ? buffsp_->template release_target<Func>() : nullptr;
+            }
+
+            [[nodiscard]] const Header& header() const noexcept
+            {
+                return hdr_;
+            }
+
+            [[nodiscard]] Header& header() noexcept
+            {
+                return hdr_;
+            }
+
+            [[nodiscard]] T* data() const noexcept
+            {
+                return buffsp_ ? buffsp_->data() : nullptr;
+            }
+            [[nodiscard]] T* data()
+            {
+                detach_on_write();
+                return buffsp_ ? buffsp_->data() : nullptr;
+            }
+
+            [[nodiscard]] const T& operator()(std::int64_t index) const noexcept
+            {
+                return buffsp_->data()[modulo(index, hdr_.last_index() + 1)];
+            }
+            [[nodiscard]] T& operator()(std::int64_t index)
+            {
+                detach_on_write();
+                return buffsp_->data()[modulo(index, hdr_.last_index() + 1)];
+            }
+
+            /**
+            * @note Unchecked element access, by buffer index or by subscripts, for loops that already keep their indices
+            * in range. No modulus is applied and the number of subscripts is expected to be equal to the number of dimensions.
+            */
+            [[nodiscard]] const T& at_unchecked(std::int64_t index) const noexcept
+            {
+                return buffsp_->data()[index];
+            }
+            [[nodiscard]] T& at_unchecked(std::int64_t index)
+            {
+                detach_on_write();
+                return buffsp_->data()[index];
+            }
+
+            [[nodiscard]] const T& at_unchecked(std::span<const std::int64_t> subs) const noexcept
+            {
+                return buffsp_->data()[subs2ind_unchecked(hdr_.offset(), hdr_.strides(), subs)];
+            }
+            [[nodiscard]] const T& at_unchecked(std::initializer_list<std::int64_t> subs) const noexcept
+            {
+                return at_unchecked(std::span<const std::int64_t>{ subs.begin(), subs.size() });
+            }
+
+            [[nodiscard]] T& at_unchecked(std::span<const std::int64_t> subs)
+            {
+                detach_on_write();
+                return buffsp_->data()[subs2ind_unchecked(hdr_.offset(), hdr_.strides(), subs)];
+            }
+            [[nodiscard]] T& at_unchecked(std::initializer_list<std::int64_t> subs)
+            {
+                return at_unchecked(std::span<const std::int64_t>{ subs.begin(), subs.size() });
+            }
+
+            [[nodiscard]] const T& operator()(std::span<std::int64_t> subs) const noexcept
+            {
+                return buffsp_->data()[subs2ind(hdr_.offset(), hdr_.strides(), hdr_.dims(), subs)];
+            }
+            [[nodiscard]] const T& operator()(std::initializer_list<std::int64_t> subs) const noexcept
+            {
+                return (*this)(std::span<std::int64_t>{ const_cast<std::int64_t*>(subs.begin()), subs.size() });
+            }
+
+            [[nodiscard]] T& operator()(std::span<std::int64_t> subs)
+            {
+                detach_on_write();
+                return buffsp_->data()[subs2ind(hdr_.offset(), hdr_.strides(), hdr_.dims(), subs)];
+            }
+            [[nodiscard]] T& operator()(std::initializer_list<std::int64_t> subs)
+            {
+                return (*this)(std::span<std::int64_t>{ const_cast<std::int64_t*>(subs.begin()), subs.size() });
+            }
+
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(std::span<const Interval<std::int64_t>> ranges) const
+            {
+                if (ranges.empty() || empty(*this)) {
+                    return (*this);
+                }
+
+                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> slice{};
+                slice.hdr_ = Header{ hdr_, ranges };
+                slice.buffsp_ = slice.hdr_.empty() ? nullptr : buffsp_;
+                return slice;
+            }
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(std::initializer_list<Interval<std::int64_t>> ranges) const
+            {
+                return (*this)(std::span<const Interval<std::int64_t>>{ranges.begin(), ranges.size()});
+            }
+
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(std::span<const Interval<std::int64_t>> ranges)
+            {
+                detach_on_write();
+                return std::as_const(*this)(ranges);
+            }
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(std::initializer_list<Interval<std::int64_t>> ranges)
+            {
+                return (*this)(std::span<const Interval<std::int64_t>>{ranges.begin(), ranges.size()});
+            }
+
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(const Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& indices) const noexcept
+            {
+                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(indices.header().dims().data(), indices.header().dims().size()), uninitialized);
+
+                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(indices.header()); gen; ++gen) {
+                    res(*gen) = buffsp_->data()[indices(*gen)];
+                }
+
+                return res;
+            }
+
+            template <typename T_o, typename Binary_op>
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& transform(const Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other, Binary_op&& op)
+            {
+                if (!std::equal(header().dims().begin(), header().dims().end(), other.header().dims().begin(), other.header().dims().end())) {
+                    Header other_hdr(other.header(), hdr_.dims(), Broadcast_tag{});
+                    if (other_hdr.empty()) {
+                        return *this;
+                    }
+
+                    broadcast_transform(data(), hdr_, other.data(), other_hdr, data(), hdr_, 0, hdr_.count(), op);
+
+                    return *this;
+                }
+
+                if (!hdr_.is_subarray() && !other.header().is_subarray()) {
+                    T* data_ptr{ data() };
+                    const T_o* other_data_ptr{ other.data() };
+                    std::int64_t i = 0;
+                    if constexpr (std::is_same_v<T, T_o> && Simd_binary_operation<T, T, Binary_op>) {
+                        i = simd_transform(data_ptr, other_data_ptr, data_ptr, hdr_.count(), op);
+                    }
+                    for (; i < hdr_.count(); ++i) {
+                        data_ptr[i] = op(data_ptr[i], other_data_ptr[i]);
+                    }
+                    return *this;
+                }
+
+                Array_indices_generator<Dims_capacity, Internals_allocator> gen(header());
+                Array_indices_generator<Dims_capacity, Internals_allocator> other_gen(other.header());
+
+                for (; gen && other_gen; ++gen, ++other_gen) {
+                    (*this)(*gen) = op((*this)(*gen), other(*other_gen));
+                }
+
+                return *this;
+            }
+
+            template <typename T_o, typename Binary_op>
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& transform(const T_o& other, Binary_op&& op)
+            {
+                detach_on_write();
+
+                if (!hdr_.is_subarray()) {
+                    T* data_ptr{ data() };
+                    std::int64_t i = 0;
+                    if constexpr (Simd_broadcastable<T, T_o> && Simd_binary_operation<T, T, Binary_op>) {
+                        i = simd_transform(data_ptr, static_cast<T>(other), data_ptr, hdr_.count(), op);
+                    }
+                    for (; i < hdr_.count(); ++i) {
+                        data_ptr[i] = op(data_ptr[i], other);
+                    }
+                    return *this;
+                }
+
+                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(header()); gen; gen.next_run()) {
+                    T* run_ptr{ buffsp_->data() + *gen };
+                    const std::int64_t run_stride{ gen.run_stride() };
+                    for (std::int64_t i = 0; i < gen.run_length(); ++i) {
+                        run_ptr[i * run_stride] = op(run_ptr[i * run_stride], other);
+                    }
+                }
+
+                return *this;
+            }
+
+            /**
+            * @note Appends rows along axis 0 in place. The buffer grows geometrically and is reallocated only when its capacity
+            * is exhausted. A subarray, or an array whose buffer is shared with other arrays or viewed by copy-on-write clones,
+            * is first copied into a buffer of its own, and the other arrays keep the previous buffer.
+            * The dimensions of rows, other than the first, should match the array dimensions, or rows should be a single row
+            * whose dimensions match them. An empty array becomes a copy of rows.
+            */
+            template <typename T_o>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& append_inplace(const Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rows)
+            {
+                if (empty(rows)) {
+                    return *this;
+                }
+
+                if (empty(*this)) {
+                    *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(rows.header().dims().data(), rows.header().dims().size()), uninitialized);
+                    copy(rows, *this);
+                    return *this;
+                }
+
+                const std::int64_t ndims{ std::ssize(hdr_.dims()) };
+                std::span<const std::int64_t> row_dims{ hdr_.dims().data() + 1, hdr_.dims().data() + ndims };
+                std::span<const std::int64_t> rows_dims{ rows.header().dims().data(), rows.header().dims().size() };
+
+                std::int64_t num_rows{ 0 };
+                if (std::ssize(rows_dims) == ndims && std::equal(rows_dims.begin() + 1, rows_dims.end(), row_dims.begin(), row_dims.end())) {
+                    num_rows = rows_dims[0];
+                }
+                else if (std::ssize(rows_dims) == ndims - 1 && std::equal(rows_dims.begin(), rows_dims.end(), row_dims.begin(), row_dims.end())) {
+                    num_rows = 1;
+                }
+                else {
+                    return *this;
+                }
+
+                T* dst{ grow_rows(num_rows, rows.header().count()) };
+                if (!rows.header().is_subarray()) {
+                    std::copy_n(rows.data(), rows.header().count(), dst);
+                }
+                else {
+                    copy_runs(rows.data(), rows.header(), dst);
+                }
+
+                return *this;
+            }
+
+            /**
+            * @note Appends a single row along axis 0 in place, as append_inplace does. An empty array becomes an array of one row.
+            */
+            template <typename T_o>
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& push_back(const Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& row)
+            {
+                if (empty(*this) && !empty(row)) {
+                    simple_dims_vector<Dims_capacity, Internals_allocator> dims(std::ssize(row.header().dims()) + 1);
+                    dims[0] = 1;
+                    std::copy(row.header().dims().begin(), row.header().dims().end(), dims.data() + 1);
+                    *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(dims.data(), dims.size()), uninitialized);
+                    copy(row, *this);
+                    return *this;
+                }
+
+                return append_inplace(row);
+            }
+
+            /**
+            * @note Appends a value to a one dimensional array in place, as append_inplace does. An empty array becomes an array of one element.
+            */
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& push_back(const T& value)
+            {
+                if (empty(*this)) {
+                    *this = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>({ 1 }, value);
+                    return *this;
+                }
+
+                if (std::ssize(hdr_.dims()) != 1) {
+                    return *this;
+                }
+
+                *grow_rows(1, 1) = value;
+                return *this;
+            }
+
+            auto begin(std::int64_t axis = 0)
+            {
+                detach_on_write();
+                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), 0);
+            }
+
+            auto end(std::int64_t axis = 0)
+            {
+                detach_on_write();
+                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), hdr_.count());
+            }
+
+
+            auto cbegin(std::int64_t axis = 0) const
+            {
+                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), 0);
+            }
+
+            auto cend(std::int64_t axis = 0) const
+            {
+                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), hdr_.count());
+            }
+
+
+            auto rbegin(std::int64_t axis = 0)
+            {
+                detach_on_write();
+                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), hdr_.count() - 1);
+            }
+
+            auto rend(std::int64_t axis = 0)
+            {
+                detach_on_write();
+                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), -1);
+            }
+
+            auto crbegin(std::int64_t axis = 0) const
+            {
+                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), hdr_.count() - 1);
+            }
+
+            auto crend(std::int64_t axis = 0) const
+            {
+                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, axis), -1);
+            }
+
+
+            auto begin(std::span<const std::int64_t> order)
+            {
+                detach_on_write();
+                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), 0);
+            }
+
+            auto end(std::span<const std::int64_t> order)
+            {
+                detach_on_write();
+                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), hdr_.count());
+            }
+
+
+            auto cbegin(std::span<const std::int64_t> order) const
+            {
+                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), 0);
+            }
+
+            auto cend(std::span<const std::int64_t> order) const
+            {
+                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), hdr_.count());
+            }
+
+
+            auto rbegin(std::span<const std::int64_t> order)
+            {
+                detach_on_write();
+                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), hdr_.count() - 1);
+            }
+
+            auto rend(std::span<const std::int64_t> order)
+            {
+                detach_on_write();
+                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), -1);
+            }
+
+            auto crbegin(std::span<const std::int64_t> order) const
+            {
+                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), hdr_.count() - 1);
+            }
+
+            auto crend(std::span<const std::int64_t> order) const
+            {
+                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_iteration_layout<Dims_capacity, Internals_allocator>(hdr_, order), -1);
+            }
+
+
+
+            auto begin(std::initializer_list<std::int64_t> order)
+            {
+                return begin(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+            auto end(std::initializer_list<std::int64_t> order)
+            {
+                return end(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+
+            auto cbegin(std::initializer_list<std::int64_t> order) const
+            {
+                return cbegin(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+            auto cend(std::initializer_list<std::int64_t> order) const
+            {
+                return cend(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+
+            auto rbegin(std::initializer_list<std::int64_t> order)
+            {
+                return rbegin(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+            auto rend(std::initializer_list<std::int64_t> order)
+            {
+                return rend(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+            auto crbegin(std::initializer_list<std::int64_t> order) const
+            {
+                return crbegin(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+            auto crend(std::initializer_list<std::int64_t> order) const
+            {
+                return crend(std::span<const std::int64_t>(order.begin(), order.size()));
+            }
+
+
+        private:
+            /**
+            * @note Expands the buffer by count elements, adds num_rows to the first dimension and returns the first added element.
+            */
+            T* grow_rows(std::int64_t num_rows, std::int64_t count)
+            {
+                // growing may reallocate the buffer, which would invalidate the pointers and iterators of other arrays sharing
+                // or viewing it, so they keep the current buffer
+                if (hdr_.is_subarray() || hdr_.offset() != 0 || hdr_.count() != buffsp_->size() || buffsp_.use_count() > 1 || buffsp_->is_viewed()) {
+                    *this = clone(std::as_const(*this));
+                }
+                else {
+                    detach_on_write();
+                }
+
+                const std::int64_t prev_count{ hdr_.count() };
+                buffsp_->expand(count);
+
+                simple_dims_vector<Dims_capacity, Internals_allocator> dims(std::ssize(hdr_.dims()), hdr_.dims().data());
+                dims[0] += num_rows;
+                hdr_ = Header(std::span<const std::int64_t>(dims.data(), dims.size()));
+
+                return buffsp_->data() + prev_count;
+            }
+
+            void detach_on_write()
+            {
+                if (!buffsp_ || (!buffsp_->is_copy_on_write() && !buffsp_->is_viewed())) {
+                    return;
+                }
+
+                // no other array shares the buffer, so only the viewed elements are copied
+                if (buffsp_.use_count() == 1 && hdr_.is_subarray()) {
+                    *this = clone(std::as_const(*this));
+                    return;
+                }
+
+                buffsp_->detach();
+            }
+
+            Header hdr_{};
+            std::shared_ptr<simple_vector<T, Data_capacity, Data_allocator>> buffsp_{ nullptr };
+        };
+
+        /**
+        * @note View of an array of a rank known at compile time. Dimensions and strides are cached in fixed size arrays,
+        * so that subscripts to index computations are unrolled and traversals are nested loops with a contiguous
+        * innermost loop when possible.
+        * The view shares the data of the array it is created from, and is empty if the ranks do not match. The data
+        * pointer is read from the shared buffer on each access, so that a copy-on-write buffer is copied on the first write.
+        * Subscripts are handled as in Array, i.e. by modulus of the dimensions.
+        */
+        template <typename T, std::int64_t Rank, std::int64_t Data_capacity = dynamic_sequence, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        requires (Rank > 0)
+        class Fixed_rank_array final {
+        public:
+            using Array_type = Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>;
+
+            static constexpr std::int64_t rank = Rank;
+
+            Fixed_rank_array() = default;
+
+            Fixed_rank_array(const Array_type& arr)
+                : arr_(std::ssize(arr.header().dims()) == Rank ? arr : Array_type{})
+            {
+                cache();
+            }
+
+            Fixed_rank_array(const std::array<std::int64_t, Rank>& dims)
+                : arr_(std::span<const std::int64_t>(dims))
+            {
+                cache();
+            }
+
+            Fixed_rank_array(const std::array<std::int64_t, Rank>& dims, const T& value)
+                : arr_(std::span<const std::int64_t>(dims), value)
+            {
+                cache();
+            }
+
+            Fixed_rank_array(const Fixed_rank_array&) = default;
+            Fixed_rank_array& operator=(const Fixed_rank_array&) = default;
+            Fixed_rank_array(Fixed_rank_array&&) = default;
+            Fixed_rank_array& operator=(Fixed_rank_array&&) = default;
+
+            /**
+            * @note The returned array shares the data of the view.
+            */
+            [[nodiscard]] const Array_type& array() const noexcept
+            {
+                return arr_;
+            }
+
+            [[nodiscard]] const std::array<std::int64_t, Rank>& dims() const noexcept
+            {
+                return dims_;
+            }
+
+            [[nodiscard]] const std::array<std::int64_t, Rank>& strides() const noexcept
+            {
+                return strides_;
+            }
+
+            [[nodiscard]] std::int64_t count() const noexcept
+            {
+                return arr_.header().count();
+            }
+
+            [[nodiscard]] bool empty() const noexcept
+            {
+                return !arr_.data();
+            }
+
+            template <std::integral... Subs>
+            requires (sizeof...(Subs) == Rank)
+            [[nodiscard]] std::int64_t subs2ind(Subs... subs) const noexcept
+            {
+                return subs2ind(std::make_index_sequence<Rank>{}, static_cast<std::int64_t>(subs)...);
+            }
+
+            template <std::integral... Subs>
+            requires (sizeof...(Subs) == Rank)
+            [[nodiscard]] const T& operator()(Subs... subs) const noexcept
+            {
+                return arr_.data()[subs2ind(subs...)];
+            }
+
+            template <std::integral... Subs>
+            requires (sizeof...(Subs) == Rank)
+            [[nodiscard]] T& operator()(Subs... subs)
+            {
+                return arr_.data()[subs2ind(subs...)];
+            }
+
+            /**
+            * @note Subscripts are expected to be inside the dimensions.
+            */
+            template <std::integral... Subs>
+            requires (sizeof...(Subs) == Rank)
+            [[nodiscard]] const T& at_unchecked(Subs... subs) const noexcept
+            {
+                return arr_.data()[subs2ind_unchecked(std::make_index_sequence<Rank>{}, static_cast<std::int64_t>(subs)...)];
+            }
+
+            template <std::integral... Subs>
+            requires (sizeof...(Subs) == Rank)
+            [[nodiscard]] T& at_unchecked(Subs... subs)
+            {
+                return arr_.data()[subs2ind_unchecked(std::make_index_sequence<Rank>{}, static_cast<std::int64_t>(subs)...)];
+            }
+
+            /**
+            * @note Calls op for each element in row major order.
+            */
+            template <typename Unary_op>
+            void for_each(Unary_op&& op) const
+            {
+                if (!empty()) {
+                    loop<0>(arr_.data() + offset_, op);
+                }
+            }
+
+            template <typename Unary_op>
+            void for_each(Unary_op&& op)
+            {
+                if (!empty()) {
+                    loop<0>(arr_.data() + offset_, op);
+                }
+            }
+
+        private:
+            void cache()
+            {
+                if (arr_.header().empty()) {
+                    arr_ = Array_type{};
+                    return;
+                }
+                std::copy_n(arr_.header().dims().begin(), Rank, dims_.begin());
+                std::copy_n(arr_.header().strides().begin(), Rank, strides_.begin());
+                offset_ = arr_.header().offset();
+            }
+
+            template <std::size_t... Axes>
+            [[nodiscard]] std::int64_t subs2ind(std::index_sequence<Axes...>, std::same_as<std::int64_t> auto... subs) const noexcept
+            {
+                return offset_ + ((strides_[Axes] * modulo(subs, dims_[Axes])) + ...);
+            }
+
+            template <std::size_t... Axes>
+            [[nodiscard]] std::int64_t subs2ind_unchecked(std::index_sequence<Axes...>, std::same_as<std::int64_t> auto... subs) const noexcept
+            {
+                return offset_ + ((strides_[Axes] * subs) + ...);
+            }
+
+            template <std::int64_t Axis, typename Unary_op>
+            void loop(T* ptr, Unary_op& op) const
+            {
+                if constexpr (Axis == Rank - 1) {
+                    if (strides_[Axis] == 1) {
+                        for (std::int64_t i = 0; i < dims_[Axis]; ++i) {
+                            op(ptr[i]);
+                        }
+                    }
+                    else {
+                        for (std::int64_t i = 0; i < dims_[Axis]; ++i) {
+                            op(ptr[i * strides_[Axis]]);
+                        }
+                    }
+                }
+                else {
+                    for (std::int64_t i = 0; i < dims_[Axis]; ++i) {
+                        loop<Axis + 1>(ptr + i * strides_[Axis], op);
+                    }
+                }
+            }
+
+            Array_type arr_{};
+            std::array<std::int64_t, Rank> dims_{};
+            std::array<std::int64_t, Rank> strides_{};
+            std::int64_t offset_{ 0 };
+        };
+
+        /**
+        * @note Copy is being performed even if dimensions are not match either partialy or by indices modulus.
+        */
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator1, template<typename> typename Internals_allocator1, template<typename> typename Data_allocator2, template<typename> typename Internals_allocator2>
+        inline void copy(const Array<T1, Data_capacity, Dims_capacity, Data_allocator1, Internals_allocator1>& src, Array<T2, Data_capacity, Dims_capacity, Data_allocator2, Internals_allocator2>& dst)
+        {
+            if (empty(src) || empty(dst)) {
+                return;
+            }
+
+            if (!src.header().is_subarray() && !dst.header().is_subarray()) {
+                std::copy_n(src.data(), std::min(src.header().count(), dst.header().count()), dst.data());
+                return;
+            }
+
+            Array_indices_generator<Dims_capacity, Internals_allocator1> src_gen(src.header());
+            Array_indices_generator<Dims_capacity, Internals_allocator2> dst_gen(dst.header());
+
+            for (; src_gen && dst_gen; ++src_gen, ++dst_gen) {
+                dst(*dst_gen) = src(*src_gen);
+            }
+        }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator1, template<typename> typename Internals_allocator1, template<typename> typename Data_allocator2, template<typename> typename Internals_allocator2>
+        inline void copy(const Array<T1, Data_capacity, Dims_capacity, Data_allocator1, Internals_allocator1>& src, Array<T2, Data_capacity, Dims_capacity, Data_allocator2, Internals_allocator2>&& dst)
+        {
+            copy(src, dst);
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> clone(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> clone(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()), uninitialized);
+
+            if (!arr.header().is_subarray()) {
+                std::copy_n(arr.data(), arr.header().count(), clone.data());
+                return clone;
+            }
+
+            copy_runs(arr.data(), arr.header(), clone.data());
+
+            return clone;
+        }
+
+        /**
+        * @note The clone shares the buffer of the input array until either of them is first accessed for writing.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> clone(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Copy_on_write_tag)
+        {
+            return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(arr, copy_on_write);
+        }
+
+        /**
+        * @note Returning a reference to the input array, except in case of resulted empty array or an input subarray
+        * whose elements cannot be viewed by the new dimensions (see reshape_copies).
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> reshape(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> new_dims)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (arr.header().dims() == new_dims) {
+                return arr;
+            }
+
+            if (arr.header().count() != numel(new_dims)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (arr.header().is_subarray()) {
+                typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header view_header(arr.header(), new_dims, Reshape_tag{});
+                if (!view_header.empty()) {
+                    Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(arr);
+                    res.header() = std::move(view_header);
+                    return res;
+                }
+
+                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(new_dims.data(), new_dims.size()), uninitialized);
+
+                copy_runs(arr.data(), arr.header(), res.data());
+
+                return res;
+            }
+
+            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(new_dims);
+            if (new_header.empty()) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(arr);
+            res.header() = std::move(new_header);
+
+            return res;
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> reshape(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> new_dims)
+        {
+            return reshape(arr, std::span<const std::int64_t>(new_dims.begin(), new_dims.size()));
+        }
+
+        /**
+        * @note Whether reshape copies the elements of the array into a new buffer, i.e. the array is a subarray
+        * whose strides are not compatible with the new dimensions. Invalid reshapes do not copy.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool reshape_copies(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> new_dims)
+        {
+            if (empty(arr) || !arr.header().is_subarray() || arr.header().dims() == new_dims || arr.header().count() != numel(new_dims)) {
+                return false;
+            }
+
+            return typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header(arr.header(), new_dims, Reshape_tag{}).empty();
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool reshape_copies(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> new_dims)
+        {
+            return reshape_copies(arr, std::span<const std::int64_t>(new_dims.begin(), new_dims.size()));
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> resize(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> new_dims)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(new_dims.data(), new_dims.size()));
+            }
+
+            if (arr.header().dims() == new_dims) {
+                return clone(arr);
+            }
+
+            if (numel(new_dims) <= 0) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(new_dims.data(), new_dims.size()), uninitialized);
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
+            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+
+            std::int64_t num_copied{ 0 };
+            while (arr_gen && res_gen) {
+                res(*res_gen) = arr(*arr_gen);
+                ++arr_gen;
+                ++res_gen;
+                ++num_copied;
+            }
+            std::fill(res.data() + num_copied, res.data() + res.header().count(), T{});
+
+            return res;
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> resize(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> new_dims)
+        {
+            return resize(arr, std::span<const std::int64_t>(new_dims.begin(), new_dims.size()));
+        }
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> append(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            if (empty(lhs)) {
+                return clone(rhs);
+            }
+
+            if (empty(rhs)) {
+                return clone(lhs);
+            }
+
+            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() }, uninitialized);
+
+            T1* res_data_ptr{ res.data() };
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(lhs.header()); gen; ++gen) {
+                *res_data_ptr++ = lhs.data()[*gen];
+            }
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(rhs.header()); gen; ++gen) {
+                *res_data_ptr++ = static_cast<T1>(rhs.data()[*gen]);
+            }
+
+            return res;
+        }
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> append(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, std::int64_t axis)
+        {
+            if (empty(lhs)) {
+                return clone(rhs);
+            }
+
+            if (empty(rhs)) {
+                return clone(lhs);
+            }
+
+            typename Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(lhs.header(), rhs.header().dims(), axis);
+            if (new_header.empty()) {
+                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>{};
+            }
+
+            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() }, uninitialized);
+            res.header() = std::move(new_header);
+
+            std::int64_t fixed_axis{ modulo(axis, std::ssize(lhs.header().dims())) };
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header(), fixed_axis);
+            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header(), fixed_axis);
+            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header(), fixed_axis);
+
+            for (; lhs_gen && res_gen; ++lhs_gen, ++res_gen) {
+                res.data()[*res_gen] = lhs.data()[*lhs_gen];
+            }
+            for (; rhs_gen && res_gen; ++rhs_gen, ++res_gen) {
+                res.data()[*res_gen] = rhs.data()[*rhs_gen];
+            }
+
+            return res;
+        }
+
+        /**
+        * @param policy Parallel execution policy, or null for a sequential copy.
+        * @note The result is allocated once, and each array is copied into its slabs of the result, in parallel across arrays
+        * if a policy is given. Empty arrays are skipped, and the result is empty if the dimensions of the other arrays
+        * differ outside of the axis.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> concatenate_arrays(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t axis, const Parallel_execution_policy* policy)
+        {
+            const auto first{ std::find_if(arrs.begin(), arrs.end(), [](const auto& arr) { return !empty(arr); }) };
+            if (first == arrs.end()) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const std::span<const std::int64_t> first_dims{ first->header().dims() };
+            const std::int64_t ndims{ std::ssize(first_dims) };
+            const std::int64_t fixed_axis{ modulo(axis, ndims) };
+
+            simple_dims_vector<Dims_capacity, Internals_allocator> dims(first_dims.begin(), first_dims.end());
+            dims[fixed_axis] = 0;
+            for (const auto& arr : arrs) {
+                if (empty(arr)) {
+                    continue;
+                }
+                const std::span<const std::int64_t> arr_dims{ arr.header().dims() };
+                if (std::ssize(arr_dims) != ndims) {
+                    return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                }
+                for (std::int64_t i = 0; i < ndims; ++i) {
+                    if (i != fixed_axis && arr_dims[i] != first_dims[i]) {
+                        return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                    }
+                }
+                dims[fixed_axis] += arr_dims[fixed_axis];
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(dims.data(), dims.size()), uninitialized);
+
+            const std::int64_t inner{ std::accumulate(dims.begin() + fixed_axis + 1, dims.end(), std::int64_t{ 1 }, std::multiplies<>{}) };
+            const std::int64_t res_slab_count{ dims[fixed_axis] * inner };
+
+            simple_vector<std::int64_t, dynamic_sequence, Internals_allocator> slab_offsets(std::ssize(arrs));
+            std::int64_t slab_offset{ 0 };
+            for (std::int64_t i = 0; i < std::ssize(arrs); ++i) {
+                slab_offsets[i] = slab_offset;
+                if (!empty(arrs[i])) {
+                    slab_offset += arrs[i].header().dims()[fixed_axis] * inner;
+                }
+            }
+
+            auto copy_arrays = [&](std::int64_t begin, std::int64_t end) {
+                for (std::int64_t i = begin; i < end; ++i) {
+                    if (empty(arrs[i])) {
+                        continue;
+                    }
+                    copy_slabs(arrs[i].data(), arrs[i].header(), arrs[i].header().dims()[fixed_axis] * inner, res.data() + slab_offsets[i], res_slab_count);
+                }
+            };
+
+            if (!policy) {
+                copy_arrays(0, std::ssize(arrs));
+            }
+            else {
+                policy->thread_pool().parallel_for(std::ssize(arrs), std::max<std::int64_t>(policy->min_chunk_size * std::ssize(arrs) / res.header().count(), 1), copy_arrays);
+            }
+
+            return res;
+        }
+
+        /**
+        * @note Joins the arrays along an existing axis, as successive calls to append along the axis would, with a single allocation.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> concatenate(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t axis = 0)
+        {
+            return concatenate_arrays(arrs, axis, nullptr);
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> concatenate(std::initializer_list<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t axis = 0)
+        {
+            return concatenate(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(arrs.begin(), arrs.size()), axis);
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> concatenate(const Parallel_execution_policy& policy, std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t axis = 0)
+        {
+            return concatenate_arrays(arrs, axis, &policy);
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> concatenate(const Parallel_execution_policy& policy, std::initializer_list<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t axis = 0)
+        {
+            return concatenate(policy, std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(arrs.begin(), arrs.size()), axis);
+        }
+
+        /**
+        * @note Views each array with a dimension of size one inserted at the new axis, and concatenates the views along it.
+        * The result is empty if the dimensions of the non empty arrays differ.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> stack_arrays(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t new_axis, const Parallel_execution_policy* policy)
+        {
+            const auto first{ std::find_if(arrs.begin(), arrs.end(), [](const auto& arr) { return !empty(arr); }) };
+            if (first == arrs.end()) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const std::span<const std::int64_t> first_dims{ first->header().dims() };
+            const std::int64_t fixed_axis{ modulo(new_axis, std::ssize(first_dims) + 1) };
+
+            simple_dims_vector<Dims_capacity, Internals_allocator> dims(std::ssize(first_dims) + 1);
+            std::copy(first_dims.begin(), first_dims.begin() + fixed_axis, dims.begin());
+            dims[fixed_axis] = 1;
+            std::copy(first_dims.begin() + fixed_axis, first_dims.end(), dims.begin() + fixed_axis + 1);
+
+            std::vector<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> views;
+            views.reserve(arrs.size());
+            for (const auto& arr : arrs) {
+                if (empty(arr)) {
+                    continue;
+                }
+                if (arr.header().dims() != first_dims) {
+                    return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                }
+                views.push_back(reshape(arr, std::span<const std::int64_t>(dims.data(), dims.size())));
+            }
+
+            return concatenate_arrays(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(views.data(), views.size()), fixed_axis, policy);
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> stack(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t new_axis = 0)
+        {
+            return stack_arrays(arrs, new_axis, nullptr);
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> stack(std::initializer_list<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t new_axis = 0)
+        {
+            return stack(std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(arrs.begin(), arrs.size()), new_axis);
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> stack(const Parallel_execution_policy& policy, std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t new_axis = 0)
+        {
+            return stack_arrays(arrs, new_axis, &policy);
+        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> stack(const Parallel_execution_policy& policy, std::initializer_list<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> arrs, std::int64_t new_axis = 0)
+        {
+            return stack(policy, std::span<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(arrs.begin(), arrs.size()), new_axis);
+        }
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> insert(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, std::int64_t ind)
+        {
+            if (empty(lhs)) {
+                return clone(rhs);
+            }
+
+            if (empty(rhs)) {
+                return clone(lhs);
+            }
+
+            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() }, uninitialized);
+
+            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rlhs(reshape(lhs, { lhs.header().count() }));
+            Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rrhs(reshape(rhs, { rhs.header().count() }));
+
+            std::int64_t fixed_ind{ modulo(ind, lhs.header().count() + 1) };
+
+            for (std::int64_t i = 0; i < fixed_ind; ++i) {
+                res({ i }) = rlhs({ i });
+            }
+            for (std::int64_t i = 0; i < rhs.header().count(); ++i) {
+                res({ fixed_ind + i }) = rrhs({ i });
+            }
+            for (std::int64_t i = 0; i < lhs.header().count() - fixed_ind; ++i) {
+                res({ fixed_ind + rhs.header().count() + i }) = rlhs({ fixed_ind + i });
+            }
+
+            return res;
+        }
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> insert(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, std::int64_t ind, std::int64_t axis)
+        {
+            if (empty(lhs)) {
+                return clone(rhs);
+            }
+
+            if (empty(rhs)) {
+                return clone(lhs);
+            }
+
+            typename Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(lhs.header(), rhs.header().dims(), axis);
+            if (new_header.empty()) {
+                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() }, uninitialized);
+            res.header() = std::move(new_header);
+
+            std::int64_t fixed_axis{ modulo(axis, std::ssize(lhs.header().dims())) };
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header(), fixed_axis);
+            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header(), fixed_axis);
+            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header(), fixed_axis);
+
+            std::int64_t fixed_ind{ modulo(ind, lhs.header().dims()[fixed_axis]) };
+            std::int64_t cycle = fixed_ind *
+                (std::accumulate(res.header().dims().begin(), res.header().dims().end(), 1, std::multiplies<>{}) / res.header().dims()[fixed_axis]);
+
+            for (; lhs_gen && res_gen && cycle; --cycle, ++lhs_gen, ++res_gen) {
+                res.data()[*res_gen] = lhs.data()[*lhs_gen];
+            }
+            for (; rhs_gen && res_gen; ++rhs_gen, ++res_gen) {
+                res.data()[*res_gen] = rhs.data()[*rhs_gen];
+            }
+            for (; lhs_gen && res_gen; ++lhs_gen, ++res_gen) {
+                res.data()[*res_gen] = lhs.data()[*lhs_gen];
+            }
+
+            return res;
+        }
+
+        /**
+        * @note All elements starting from ind are being removed in case that count value is too big.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> remove(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t ind, std::int64_t count)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            std::int64_t fixed_ind{ modulo(ind, arr.header().count()) };
+            std::int64_t fixed_count{ fixed_ind + count < arr.header().count() ? count : (arr.header().count() - fixed_ind) };
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() - fixed_count }, uninitialized);
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rarr(reshape(arr, { arr.header().count() }));
+
+            for (std::int64_t i = 0; i < fixed_ind; ++i) {
+                res({ i }) = rarr({ i });
+            }
+            for (std::int64_t i = fixed_ind + fixed_count; i < arr.header().count(); ++i) {
+                res({ i - fixed_count }) = rarr({ i });
+            }
+
+            return res;
+        }
+
+        /**
+        * @note All elements starting from ind are being removed in case that count value is too big.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> remove(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t ind, std::int64_t count, std::int64_t axis)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            std::int64_t fixed_axis{ modulo(axis, std::ssize(arr.header().dims())) };
+            std::int64_t fixed_ind{ modulo(ind, arr.header().dims()[fixed_axis]) };
+            std::int64_t fixed_count{ fixed_ind + count <= arr.header().dims()[fixed_axis] ? count : (arr.header().dims()[fixed_axis] - fixed_ind) };
+
+            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), -fixed_count, fixed_axis);
+            if (new_header.empty()) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() - (arr.header().count() / arr.header().dims()[fixed_axis]) * fixed_count }, uninitialized);
+            res.header() = std::move(new_header);
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header(), fixed_axis);
+            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header(), fixed_axis);
+
+            std::int64_t cycle = fixed_ind *
+                (std::accumulate(res.header().dims().begin(), res.header().dims().end(), 1, std::multiplies<>{}) / res.header().dims()[fixed_axis]);
+
+            std::int64_t removals = arr.header().count() - res.header().count();
+
+            for (; arr_gen && res_gen && cycle; --cycle, ++arr_gen, ++res_gen) {
+                res.data()[*res_gen] = arr.data()[*arr_gen];
+            }
+            for (; arr_gen && removals; --removals, ++arr_gen) {
+                //arr.data()[*arr_gen] = rhs.data()[*rhs_gen];
+            }
+            for (; arr_gen && res_gen; ++arr_gen, ++res_gen) {
+                res.data()[*res_gen] = arr.data()[*arr_gen];
+            }
+
+            return res;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool empty(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr) noexcept
+        {
+            return !arr.data() && arr.header().empty();
+        }
+
+        template <typename T, typename Unary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>    
+        [[nodiscard]] inline auto transform(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_op&& op)
+            -> Array<decltype(op(arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(arr.data()[0]));
+
+            if (empty(arr)) {
+                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()), uninitialized);
+
+            if (!arr.header().is_subarray()) {
+                const T* arr_data_ptr{ arr.data() };
+                T_o* res_data_ptr{ res.data() };
+                for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+                    res_data_ptr[i] = op(arr_data_ptr[i]);
+                }
+                return res;
+            }
+
+            const T* arr_data_ptr{ arr.data() };
+            T_o* res_data_ptr{ res.data() };
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; gen.next_run()) {
+                const T* run_ptr{ arr_data_ptr + *gen };
+                const std::int64_t run_stride{ gen.run_stride() };
+                const std::int64_t run_length{ gen.run_length() };
+                for (std::int64_t i = 0; i < run_length; ++i) {
+                    res_data_ptr[i] = op(run_ptr[i * run_stride]);
+                }
+                res_data_ptr += run_length;
+            }
+
+            return res;
+        }
+
+        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op)
+            -> decltype(op(arr.data()[0], arr.data()[0]))
+        {
+            using T_o = decltype(op(arr.data()[0], arr.data()[0]));
+
+            if (empty(arr)) {
+                return T_o{};
+            }
+
+            if (!arr.header().is_subarray()) {
+                const T* arr_data_ptr{ arr.data() };
+                T_o res{ static_cast<T_o>(arr_data_ptr[0]) };
+                for (std::int64_t i = 1; i < arr.header().count(); ++i) {
+                    res = op(res, arr_data_ptr[i]);
+                }
+                return res;
+            }
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> gen{ arr.header() };
+
+            T_o res{ static_cast<T_o>(arr(*gen)) };
+            ++gen;
+
+            while (gen) {
+                res = op(res, arr(*gen));
+                ++gen;
+            }
+
+            return res;
+        }
+
+        template <typename T, typename T_o, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const T_o& init_value, Binary_op&& op)
+            -> decltype(op(init_value, arr.data()[0]))
+        {
+            if (empty(arr)) {
+                return init_value;
+            }
+
+            T_o res{ init_value };
+
+            if (!arr.header().is_subarray()) {
+                const T* arr_data_ptr{ arr.data() };
+                for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+                    res = op(res, arr_data_ptr[i]);
+                }
+                return res;
+            }
+
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen{ arr.header() }; gen; ++gen) {
+                res = op(res, arr(*gen));
+            }
+
+            return res;
+        }
+
+        /**
+        * @param policy Parallel execution policy, or null for a sequential reduction.
+        * @note Subarrays are copied into a dense array before the reduction.
+        */
+        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce_axis(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op, std::int64_t axis, const Parallel_execution_policy* policy)
+            -> Array<decltype(op(arr.data()[0], arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(arr.data()[0], arr.data()[0]));
+
+            if (empty(arr)) {
+                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (arr.header().is_subarray()) {
+                return reduce_axis(clone(arr), std::forward<Binary_op>(op), axis, policy);
+            }
+
+            const std::int64_t fixed_axis{ modulo(axis, std::ssize(arr.header().dims())) };
+
+            typename Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), fixed_axis);
+            if (new_header.empty()) {
+                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ new_header.count() }, uninitialized);
+            res.header() = std::move(new_header);
+
+            std::span<const std::int64_t> dims{ arr.header().dims() };
+            const std::int64_t outer{ std::accumulate(dims.begin(), dims.begin() + fixed_axis, std::int64_t{ 1 }, std::multiplies<>{}) };
+            const std::int64_t inner{ std::accumulate(dims.begin() + fixed_axis + 1, dims.end(), std::int64_t{ 1 }, std::multiplies<>{}) };
+            reduce_dense_axis(arr.data(), res.data(), outer, dims[fixed_axis], inner, op, policy);
+
+            return res;
+        }
+
+        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op, std::int64_t axis)
+            -> Array<decltype(op(arr.data()[0], arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            return reduce_axis(arr, std::forward<Binary_op>(op), axis, nullptr);
+        }
+
+        template <typename T, typename T_o, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& init_values, Binary_op&& op, std::int64_t axis)
+            -> Array<decltype(op(init_values.data()[0], arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            if (empty(arr)) {
+                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const std::int64_t fixed_axis{ modulo(axis, std::ssize(arr.header().dims())) };
+
+            if (init_values.header().dims().size() != 1 && init_values.header().dims()[fixed_axis] != arr.header().dims()[fixed_axis]) {
+                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            typename Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), axis);
+            if (new_header.empty()) {
+                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ new_header.count() });
+            res.header() = std::move(new_header);
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header(), std::ssize(arr.header().dims()) - fixed_axis - 1);
+            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+            Array_indices_generator<Dims_capacity, Internals_allocator> init_gen(init_values.header());
+
+            const std::int64_t reduction_iteration_cycle{ arr.header().dims()[fixed_axis] };
+
+            while (arr_gen && res_gen && init_gen) {
+                T_o res_element{ init_values(*init_gen) };
+                for (std::int64_t i = 0; i < reduction_iteration_cycle; ++i, ++arr_gen) {
+                    res_element = op(res_element, arr(*arr_gen));
+                }
+                res(*res_gen) = std::move(res_element);
+                ++res_gen;
+                ++init_gen;
+            }
+
+            return res;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool all(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return reduce(arr, [](const T& a, const T& b) { return a && b; });
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> all(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t axis)
+        {
+            return reduce(arr, [](const T& a, const T& b) { return a && b; }, axis);
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool any(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return reduce(arr, [](const T& a, const T& b) { return a || b; });
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> any(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t axis)
+        {
+            return reduce(arr, [](const T& a, const T& b) { return a || b; }, axis);
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs.data()[0]));
+            
+            if (!std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
+                simple_dims_vector<Dims_capacity, Internals_allocator> dims(std::max(lhs.header().dims().size(), rhs.header().dims().size()));
+                if (compute_broadcast_dims(lhs.header().dims(), rhs.header().dims(), dims) <= 0) {
+                    return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                }
+
+                Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(dims.data(), dims.size()), uninitialized);
+
+                broadcast_transform(
+                    lhs.data(), Array_header<Dims_capacity, Internals_allocator>(lhs.header(), res.header().dims(), Broadcast_tag{}),
+                    rhs.data(), Array_header<Dims_capacity, Internals_allocator>(rhs.header(), res.header().dims(), Broadcast_tag{}),
+                    res.data(), res.header(), 0, res.header().count(), op);
+
+                return res;
+            }
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(lhs.header().dims().data(), lhs.header().dims().size()), uninitialized);
+
+            if (!lhs.header().is_subarray() && !rhs.header().is_subarray()) {
+                const T1* lhs_data_ptr{ lhs.data() };
+                const T2* rhs_data_ptr{ rhs.data() };
+                T_o* res_data_ptr{ res.data() };
+                std::int64_t i = 0;
+                if constexpr (std::is_same_v<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                    i = simd_transform(lhs_data_ptr, rhs_data_ptr, res_data_ptr, lhs.header().count(), op);
+                }
+                for (; i < lhs.header().count(); ++i) {
+                    res_data_ptr[i] = op(lhs_data_ptr[i], rhs_data_ptr[i]);
+                }
+                return res;
+            }
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header());
+            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header());
+            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+
+            for (; lhs_gen && rhs_gen && res_gen; ++lhs_gen, ++rhs_gen, ++res_gen) {
+                res(*res_gen) = op(lhs(*lhs_gen), rhs(*rhs_gen));
+            }
+
+            return res;
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto transform(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs)), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs));
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(lhs.header().dims().data(), lhs.header().dims().size()), uninitialized);
+
+            if (!lhs.header().is_subarray()) {
+                const T1* lhs_data_ptr{ lhs.data() };
+                T_o* res_data_ptr{ res.data() };
+                std::int64_t i = 0;
+                if constexpr (Simd_broadcastable<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                    i = simd_transform(lhs_data_ptr, static_cast<T1>(rhs), res_data_ptr, lhs.header().count(), op);
+                }
+                for (; i < lhs.header().count(); ++i) {
+                    res_data_ptr[i] = op(lhs_data_ptr[i], rhs);
+                }
+                return res;
+            }
+
+            const T1* lhs_data_ptr{ lhs.data() };
+            T_o* res_data_ptr{ res.data() };
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header()); lhs_gen; lhs_gen.next_run()) {
+                const T1* run_ptr{ lhs_data_ptr + *lhs_gen };
+                const std::int64_t run_stride{ lhs_gen.run_stride() };
+                const std::int64_t run_length{ lhs_gen.run_length() };
+                std::int64_t i = 0;
+                if constexpr (Simd_broadcastable<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                    if (run_stride == 1) {
+                        i = simd_transform(run_ptr, static_cast<T1>(rhs), res_data_ptr, run_length, op);
+                    }
+                }
+                for (; i < run_length; ++i) {
+                    res_data_ptr[i] = op(run_ptr[i * run_stride], rhs);
+                }
+                res_data_ptr += run_length;
+            }
+
+            return res;
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto transform(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs, rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs, rhs.data()[0]));
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(rhs.header().dims().data(), rhs.header().dims().size()), uninitialized);
+
+            if (!rhs.header().is_subarray()) {
+                const T2* rhs_data_ptr{ rhs.data() };
+                T_o* res_data_ptr{ res.data() };
+                std::int64_t i = 0;
+                if constexpr (Simd_broadcastable<T2, T1> && Simd_binary_operation<T2, T_o, Binary_op>) {
+                    i = simd_transform(static_cast<T2>(lhs), rhs_data_ptr, res_data_ptr, rhs.header().count(), op);
+                }
+                for (; i < rhs.header().count(); ++i) {
+                    res_data_ptr[i] = op(lhs, rhs_data_ptr[i]);
+                }
+                return res;
+            }
+
+            const T2* rhs_data_ptr{ rhs.data() };
+            T_o* res_data_ptr{ res.data() };
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header()); rhs_gen; rhs_gen.next_run()) {
+                const T2* run_ptr{ rhs_data_ptr + *rhs_gen };
+                const std::int64_t run_stride{ rhs_gen.run_stride() };
+                const std::int64_t run_length{ rhs_gen.run_length() };
+                std::int64_t i = 0;
+                if constexpr (Simd_broadcastable<T2, T1> && Simd_binary_operation<T2, T_o, Binary_op>) {
+                    if (run_stride == 1) {
+                        i = simd_transform(static_cast<T2>(lhs), run_ptr, res_data_ptr, run_length, op);
+                    }
+                }
+                for (; i < run_length; ++i) {
+                    res_data_ptr[i] = op(lhs, run_ptr[i * run_stride]);
+                }
+                res_data_ptr += run_length;
+            }
+
+            return res;
+        }
+
+        /**
+        * @note Operations over an expiring array whose elements are of the result type write their results into its buffer
+        * when it is reusable, i.e. dense and uniquely owned, and the dimensions are not broadcast.
+        */
+        template <typename T, typename Unary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr, Unary_op&& op)
+            -> Array<decltype(op(arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(arr.data()[0]));
+
+            if constexpr (std::is_same_v<T_o, T>) {
+                if (arr.is_reusable()) {
+                    T* arr_data_ptr{ arr.data() };
+                    for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+                        arr_data_ptr[i] = op(arr_data_ptr[i]);
+                    }
+                    return std::move(arr);
+                }
+            }
+
+            return transform(std::as_const(arr), std::forward<Unary_op>(op));
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs.data()[0]));
+
+            if constexpr (std::is_same_v<T_o, T1>) {
+                if (lhs.is_reusable() && std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
+                    T1* lhs_data_ptr{ lhs.data() };
+                    const T2* rhs_data_ptr{ rhs.data() };
+
+                    if (!rhs.header().is_subarray()) {
+                        std::int64_t i = 0;
+                        if constexpr (std::is_same_v<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                            i = simd_transform(lhs_data_ptr, rhs_data_ptr, lhs_data_ptr, lhs.header().count(), op);
+                        }
+                        for (; i < lhs.header().count(); ++i) {
+                            lhs_data_ptr[i] = op(lhs_data_ptr[i], rhs_data_ptr[i]);
+                        }
+                        return std::move(lhs);
+                    }
+
+                    for (Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header()); rhs_gen; rhs_gen.next_run()) {
+                        const T2* run_ptr{ rhs_data_ptr + *rhs_gen };
+                        const std::int64_t run_stride{ rhs_gen.run_stride() };
+                        const std::int64_t run_length{ rhs_gen.run_length() };
+                        for (std::int64_t i = 0; i < run_length; ++i) {
+                            lhs_data_ptr[i] = op(lhs_data_ptr[i], run_ptr[i * run_stride]);
+                        }
+                        lhs_data_ptr += run_length;
+                    }
+                    return std::move(lhs);
+                }
+            }
+
+            return transform(std::as_const(lhs), rhs, std::forward<Binary_op>(op));
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs.data()[0]));
+
+            if constexpr (std::is_same_v<T_o, T2>) {
+                if (rhs.is_reusable() && std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
+                    const T1* lhs_data_ptr{ lhs.data() };
+                    T2* rhs_data_ptr{ rhs.data() };
+
+                    if (!lhs.header().is_subarray()) {
+                        std::int64_t i = 0;
+                        if constexpr (std::is_same_v<T1, T2> && Simd_binary_operation<T2, T_o, Binary_op>) {
+                            i = simd_transform(lhs_data_ptr, rhs_data_ptr, rhs_data_ptr, rhs.header().count(), op);
+                        }
+                        for (; i < rhs.header().count(); ++i) {
+                            rhs_data_ptr[i] = op(lhs_data_ptr[i], rhs_data_ptr[i]);
+                        }
+                        return std::move(rhs);
+                    }
+
+                    for (Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header()); lhs_gen; lhs_gen.next_run()) {
+                        const T1* run_ptr{ lhs_data_ptr + *lhs_gen };
+                        const std::int64_t run_stride{ lhs_gen.run_stride() };
+                        const std::int64_t run_length{ lhs_gen.run_length() };
+                        for (std::int64_t i = 0; i < run_length; ++i) {
+                            rhs_data_ptr[i] = op(run_ptr[i * run_stride], rhs_data_ptr[i]);
+                        }
+                        rhs_data_ptr += run_length;
+                    }
+                    return std::move(rhs);
+                }
+            }
+
+            return transform(lhs, std::as_const(rhs), std::forward<Binary_op>(op));
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs.data()[0]));
+
+            if constexpr (std::is_same_v<T_o, T1>) {
+                if (lhs.is_reusable()) {
+                    return transform(std::move(lhs), std::as_const(rhs), std::forward<Binary_op>(op));
+                }
+            }
+
+            return transform(std::as_const(lhs), std::move(rhs), std::forward<Binary_op>(op));
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto transform(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs)), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs));
+
+            if constexpr (std::is_same_v<T_o, T1>) {
+                if (lhs.is_reusable()) {
+                    T1* lhs_data_ptr{ lhs.data() };
+                    std::int64_t i = 0;
+                    if constexpr (Simd_broadcastable<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                        i = simd_transform(lhs_data_ptr, static_cast<T1>(rhs), lhs_data_ptr, lhs.header().count(), op);
+                    }
+                    for (; i < lhs.header().count(); ++i) {
+                        lhs_data_ptr[i] = op(lhs_data_ptr[i], rhs);
+                    }
+                    return std::move(lhs);
+                }
+            }
+
+            return transform(std::as_const(lhs), rhs, std::forward<Binary_op>(op));
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto transform(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs, rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs, rhs.data()[0]));
+
+            if constexpr (std::is_same_v<T_o, T2>) {
+                if (rhs.is_reusable()) {
+                    T2* rhs_data_ptr{ rhs.data() };
+                    std::int64_t i = 0;
+                    if constexpr (Simd_broadcastable<T2, T1> && Simd_binary_operation<T2, T_o, Binary_op>) {
+                        i = simd_transform(static_cast<T2>(lhs), rhs_data_ptr, rhs_data_ptr, rhs.header().count(), op);
+                    }
+                    for (; i < rhs.header().count(); ++i) {
+                        rhs_data_ptr[i] = op(lhs, rhs_data_ptr[i]);
+                    }
+                    return std::move(rhs);
+                }
+            }
+
+            return transform(lhs, std::as_const(rhs), std::forward<Binary_op>(op));
+        }
+
+#if defined(COMPUTOC_SIMD_AVX512)
+        template <typename T>
+        concept Simd_compressible = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+        /**
+        * @note Stores the elements of src[0, 64) selected by bits contiguously into res. Unselected elements are not read.
+        * @return Pointer past the last stored element.
+        */
+        template <Simd_compressible T>
+        inline T* simd_compress(const T* src, std::uint64_t bits, T* res) noexcept
+        {
+            if constexpr (sizeof(T) == 4) {
+                for (std::int64_t k = 0; k < 64; k += 16, bits >>= 16) {
+                    const __mmask16 m{ static_cast<__mmask16>(bits) };
+                    if (m) {
+                        _mm512_mask_compressstoreu_epi32(res, m, _mm512_maskz_loadu_epi32(m, src + k));
+                        res += std::popcount(static_cast<std::uint16_t>(m));
+                    }
+                }
+            }
+            else {
+                for (std::int64_t k = 0; k < 64; k += 8, bits >>= 8) {
+                    const __mmask8 m{ static_cast<__mmask8>(bits) };
+                    if (m) {
+                        _mm512_mask_compressstoreu_epi64(res, m, _mm512_maskz_loadu_epi64(m, src + k));
+                        res += std::popcount(static_cast<std::uint8_t>(m));
+                    }
+                }
+            }
+            return res;
+        }
+
+        /**
+        * @note Stores the positions first + [0, 64) selected by bits contiguously into res.
+        * @return Pointer past the last stored position.
+        */
+        inline std::int64_t* simd_compress_positions(std::int64_t first, std::uint64_t bits, std::int64_t* res) noexcept
+        {
+            __m512i positions{ _mm512_add_epi64(_mm512_set1_epi64(first), _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0)) };
+            const __m512i step{ _mm512_set1_epi64(8) };
+            for (std::int64_t k = 0; k < 64; k += 8, bits >>= 8) {
+                const __mmask8 m{ static_cast<__mmask8>(bits) };
+                if (m) {
+                    _mm512_mask_compressstoreu_epi64(res, m, positions);
+                    res += std::popcount(static_cast<std::uint8_t>(m));
+                }
+                positions = _mm512_add_epi64(positions, step);
+            }
+            return res;
+        }
+#else
+        template <typename T>
+        concept Simd_compressible = false;
+#endif
+
+        /**
+        * @note Stream compaction of the positions [0, count) selected by select(position), in chunks that are processed by the
+        * thread pool of policy, or by the calling thread if it is null. Every chunk records its selection in a bitmask and counts it,
+        * an exclusive prefix sum of the counts gives the offset of every chunk in the exactly sized result, and every chunk then
+        * scatters its selected elements by calling emit(first_position, bits, res_ptr) for every 64 positions with a selection.
+        * @return Empty array if no position is selected.
+        */
+        template <typename Res, typename Select, typename Emit>
+        [[nodiscard]] inline Res compact(std::int64_t count, Select&& select, Emit&& emit, const Parallel_execution_policy* policy)
+        {
+            constexpr std::int64_t word_bits{ 64 };
+
+            const std::int64_t num_words{ (count + word_bits - 1) / word_bits };
+            const std::int64_t num_chunks{ policy
+                ? std::clamp<std::int64_t>(count / std::max<std::int64_t>(policy->min_chunk_size, 1), 1, std::min(std::max<std::int64_t>(policy->thread_pool().size(), 1), num_words))
+                : 1 };
+
+            std::vector<std::uint64_t> mask(num_words);
+            std::vector<std::int64_t> offsets(num_chunks + 1, 0);
+
+            auto for_each_chunk = [&](auto&& chunk_func) {
+                auto chunks_func = [&](std::int64_t first_chunk, std::int64_t last_chunk) {
+                    for (std::int64_t j = first_chunk; j < last_chunk; ++j) {
+                        chunk_func(j, num_words * j / num_chunks, num_words * (j + 1) / num_chunks);
+                    }
+                };
+                if (policy && num_chunks > 1) {
+                    policy->thread_pool().parallel_for(num_chunks, 1, chunks_func);
+                }
+                else {
+                    chunks_func(0, num_chunks);
+                }
+            };
+
+            for_each_chunk([&](std::int64_t j, std::int64_t first_word, std::int64_t last_word) {
+                std::int64_t chunk_count{ 0 };
+                for (std::int64_t w = first_word; w < last_word; ++w) {
+                    const std::int64_t begin{ w * word_bits };
+                    const std::int64_t end{ std::min(begin + word_bits, count) };
+                    std::uint64_t bits{ 0 };
+                    for (std::int64_t i = begin; i < end; ++i) {
+                        bits |= static_cast<std::uint64_t>(static_cast<bool>(select(i))) << (i - begin);
+                    }
+                    mask[w] = bits;
+                    chunk_count += std::popcount(bits);
+                }
+                offsets[j + 1] = chunk_count;
+            });
+
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            if (offsets[num_chunks] == 0) {
+                return Res();
+            }
+
+            Res res({ offsets[num_chunks] }, uninitialized);
+            auto res_data_ptr{ res.data() };
+
+            for_each_chunk([&](std::int64_t j, std::int64_t first_word, std::int64_t last_word) {
+                auto res_ptr{ res_data_ptr + offsets[j] };
+                for (std::int64_t w = first_word; w < last_word; ++w) {
+                    if (mask[w]) {
+                        res_ptr = emit(w * word_bits, mask[w], res_ptr);
+                    }
+                }
+            });
+
+            return res;
+        }
+
+        /**
+        * @note Compacts the elements of a dense array, selected by their positions.
+        */
+        template <typename T, typename Select, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> compact_elements(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& dense_arr, Select&& select, const Parallel_execution_policy* policy)
+        {
+            const T* data_ptr{ dense_arr.data() };
+
+            return compact<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(dense_arr.header().count(), std::forward<Select>(select), [data_ptr](std::int64_t first, std::uint64_t bits, T* res_ptr) {
+                if constexpr (Simd_compressible<T>) {
+                    return simd_compress(data_ptr + first, bits, res_ptr);
+                }
+                else {
+                    for (; bits; bits &= bits - 1) {
+                        *res_ptr++ = data_ptr[first + std::countr_zero(bits)];
+                    }
+                    return res_ptr;
+                }
+            }, policy);
+        }
+
+        /**
+        * @note Compacts the buffer indices of the positions of an array header, selected by the positions.
+        */
+        template <typename Res, std::int64_t Dims_capacity, template<typename> typename Internals_allocator, typename Select>
+        [[nodiscard]] inline Res compact_indices(const Array_header<Dims_capacity, Internals_allocator>& hdr, Select&& select, const Parallel_execution_policy* policy)
+        {
+            return compact<Res>(hdr.count(), std::forward<Select>(select), [&hdr](std::int64_t first, std::uint64_t bits, std::int64_t* res_ptr) {
+                if (hdr.is_subarray()) {
+                    for (; bits; bits &= bits - 1) {
+                        *res_ptr++ = pos2ind(hdr.offset(), hdr.strides(), hdr.dims(), first + std::countr_zero(bits));
+                    }
+                    return res_ptr;
+                }
+#if defined(COMPUTOC_SIMD_AVX512)
+                return simd_compress_positions(first, bits, res_ptr);
+#else
+                for (; bits; bits &= bits - 1) {
+                    *res_ptr++ = first + std::countr_zero(bits);
+                }
+                return res_ptr;
+#endif
+            }, policy);
+        }
+
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred, const Parallel_execution_policy* policy)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_arr{ arr.header().is_subarray() ? clone(arr) : arr };
+            const T* data_ptr{ dense_arr.data() };
+
+            return compact_elements(dense_arr, [data_ptr, &pred](std::int64_t i) { return static_cast<bool>(pred(data_ptr[i])); }, policy);
+        }
+
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred, const Parallel_execution_policy* policy)
+        {
+            if (empty(arr)) {
+                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_arr{ arr.header().is_subarray() ? clone(arr) : arr };
+            const T* data_ptr{ dense_arr.data() };
+
+            return compact_indices<Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(arr.header(), [data_ptr, &pred](std::int64_t i) { return static_cast<bool>(pred(data_ptr[i])); }, policy);
+        }
+
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        {
+            return filter(arr, pred, nullptr);
+        }
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        {
+            if (empty(arr)) {
+                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (!std::equal(arr.header().dims().begin(), arr.header().dims().end(), mask.header().dims().begin(), mask.header().dims().end())) {
+                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_arr{ arr.header().is_subarray() ? clone(arr) : arr };
+            const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_mask{ mask.header().is_subarray() ? clone(mask) : mask };
+            const T2* mask_data_ptr{ dense_mask.data() };
+
+            return compact_elements(dense_arr, [mask_data_ptr](std::int64_t i) { return static_cast<bool>(mask_data_ptr[i]); }, nullptr);
+        }
+
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        {
+            return find(arr, pred, nullptr);
+        }
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        {
+            if (empty(arr)) {
+                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (!std::equal(arr.header().dims().begin(), arr.header().dims().end(), mask.header().dims().begin(), mask.header().dims().end())) {
+                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_mask{ mask.header().is_subarray() ? clone(mask) : mask };
+            const T2* mask_data_ptr{ dense_mask.data() };
+
+            return compact_indices<Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(arr.header(), [mask_data_ptr](std::int64_t i) { return static_cast<bool>(mask_data_ptr[i]); }, nullptr);
+        }
+
+        /**
+        * @note Boolean mask of the dimensions of an array, stored as 1 bit per element in 64 bit words, in row major order.
+        * Bits past the count of the mask in its last word are always clear. Copies share the words, as with arrays.
+        */
+        template <std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        class Bit_mask final {
+        public:
+            using Header = Array_header<Dims_capacity, Internals_allocator>;
+            using Words = simple_vector<std::uint64_t, dynamic_sequence, Data_allocator>;
+
+            static constexpr std::int64_t word_bits = 64;
+
+            Bit_mask() = default;
+
+            Bit_mask(std::span<const std::int64_t> dims)
+                : hdr_(dims)
+            {
+                if (!hdr_.empty()) {
+                    wordsp_ = std::allocate_shared<Words>(Internals_allocator<Words>(), (hdr_.count() + word_bits - 1) / word_bits);
+                    std::fill_n(wordsp_->data(), wordsp_->size(), std::uint64_t{ 0 });
+                }
+            }
+
+            Bit_mask(std::initializer_list<std::int64_t> dims)
+                : Bit_mask(std::span<const std::int64_t>{ dims.begin(), dims.size() })
+            {
+            }
+
+            [[nodiscard]] const Header& header() const noexcept
+            {
+                return hdr_;
+            }
+
+            [[nodiscard]] std::int64_t num_words() const noexcept
+            {
+                return wordsp_ ? wordsp_->size() : 0;
+            }
+
+            [[nodiscard]] std::uint64_t* words() const noexcept
+            {
+                return wordsp_ ? wordsp_->data() : nullptr;
+            }
+
+            [[nodiscard]] bool test(std::int64_t pos) const noexcept
+            {
+                return (wordsp_->data()[pos / word_bits] >> (pos % word_bits)) & 1;
+            }
+
+            void set(std::int64_t pos, bool value = true) noexcept
+            {
+                const std::uint64_t bit{ std::uint64_t{ 1 } << (pos % word_bits) };
+                std::uint64_t& word{ wordsp_->data()[pos / word_bits] };
+                word = value ? (word | bit) : (word & ~bit);
+            }
+
+            /**
+            * @return Number of set bits.
+            */
+            [[nodiscard]] std::int64_t count_set() const noexcept
+            {
+                std::int64_t res{ 0 };
+                for (std::int64_t w = 0; w < num_words(); ++w) {
+                    res += std::popcount(wordsp_->data()[w]);
+                }
+                return res;
+            }
+
+            /**
+            * @return Mask of the bits of the last word that are inside the count of the mask.
+            */
+            [[nodiscard]] std::uint64_t last_word_mask() const noexcept
+            {
+                const std::int64_t tail{ hdr_.count() % word_bits };
+                return tail == 0 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << tail) - 1;
+            }
+
+        private:
+            Header hdr_{};
+            std::shared_ptr<Words> wordsp_{ nullptr };
+        };
+
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool empty(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask) noexcept
+        {
+            return mask.num_words() == 0;
+        }
+
+        /**
+        * @return Bits of the 64 elements of data, converted to bool.
+        */
+        template <typename T>
+        [[nodiscard]] inline std::uint64_t pack_word(const T* data) noexcept
+        {
+#if defined(COMPUTOC_SIMD_AVX512) || defined(COMPUTOC_SIMD_AVX2) || defined(COMPUTOC_SIMD_SSE2)
+            if constexpr (sizeof(T) == 1 && std::is_integral_v<T>) {
+                std::uint64_t bits{ 0 };
+#if defined(COMPUTOC_SIMD_AVX512) || defined(COMPUTOC_SIMD_AVX2)
+                for (std::int64_t k = 0; k < 64; k += 32) {
+                    const __m256i zeros{ _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + k)), _mm256_setzero_si256()) };
+                    bits |= static_cast<std::uint64_t>(~static_cast<std::uint32_t>(_mm256_movemask_epi8(zeros))) << k;
+                }
+#else
+                for (std::int64_t k = 0; k < 64; k += 16) {
+                    const __m128i zeros{ _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + k)), _mm_setzero_si128()) };
+                    bits |= static_cast<std::uint64_t>(~_mm_movemask_epi8(zeros) & 0xffff) << k;
+                }
+#endif
+                return bits;
+            }
+#endif
+            std::uint64_t bits{ 0 };
+            for (std::int64_t i = 0; i < 64; ++i) {
+                bits |= static_cast<std::uint64_t>(static_cast<bool>(data[i])) << i;
+            }
+            return bits;
+        }
+
+        /**
+        * @note Packs the elements of an array, converted to bool, into a bit mask of the same dimensions.
+        * Arrays of 1 byte elements, such as arrays of bool, are packed 16 or 32 elements per instruction when SIMD is enabled.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> pack(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            if (empty(arr)) {
+                return Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_arr{ arr.header().is_subarray() ? clone(arr) : arr };
+            const T* data_ptr{ dense_arr.data() };
+            const std::int64_t count{ dense_arr.header().count() };
+
+            Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()));
+            std::uint64_t* words_ptr{ res.words() };
+
+            const std::int64_t num_full_words{ count / 64 };
+            for (std::int64_t w = 0; w < num_full_words; ++w) {
+                words_ptr[w] = pack_word(data_ptr + w * 64);
+            }
+            for (std::int64_t i = num_full_words * 64; i < count; ++i) {
+                words_ptr[num_full_words] |= static_cast<std::uint64_t>(static_cast<bool>(data_ptr[i])) << (i - num_full_words * 64);
+            }
+
+            return res;
+        }
+
+        /**
+        * @note Packs the results of pred for the elements of an array into a bit mask of the same dimensions.
+        * The predicate is evaluated 64 elements at a time into a word, which compilers can vectorize for simple comparisons.
+        */
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> pack(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        {
+            if (empty(arr)) {
+                return Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_arr{ arr.header().is_subarray() ? clone(arr) : arr };
+            const T* data_ptr{ dense_arr.data() };
+            const std::int64_t count{ dense_arr.header().count() };
+
+            Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()));
+            std::uint64_t* words_ptr{ res.words() };
+
+            for (std::int64_t w = 0; w < res.num_words(); ++w) {
+                const std::int64_t begin{ w * 64 };
+                const std::int64_t end{ std::min(begin + 64, count) };
+                std::uint64_t bits{ 0 };
+                for (std::int64_t i = begin; i < end; ++i) {
+                    bits |= static_cast<std::uint64_t>(static_cast<bool>(pred(data_ptr[i]))) << (i - begin);
+                }
+                words_ptr[w] = bits;
+            }
+
+            return res;
+        }
+
+        /**
+        * @note Unpacks a bit mask into an array of bool of the same dimensions.
+        */
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator> unpack(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        {
+            if (empty(mask)) {
+                return Array<bool, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<bool, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(mask.header().dims().data(), mask.header().dims().size()), uninitialized);
+            bool* res_data_ptr{ res.data() };
+            const std::uint64_t* words_ptr{ mask.words() };
+            for (std::int64_t i = 0; i < res.header().count(); ++i) {
+                res_data_ptr[i] = (words_ptr[i / 64] >> (i % 64)) & 1;
+            }
+            return res;
+        }
+
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool all(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask) noexcept
+        {
+            if (empty(mask)) {
+                return true;
+            }
+
+            const std::uint64_t* words_ptr{ mask.words() };
+            const std::int64_t last_word{ mask.num_words() - 1 };
+            for (std::int64_t w = 0; w < last_word; ++w) {
+                if (~words_ptr[w]) {
+                    return false;
+                }
+            }
+            return words_ptr[last_word] == mask.last_word_mask();
+        }
+
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool any(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask) noexcept
+        {
+            const std::uint64_t* words_ptr{ mask.words() };
+            for (std::int64_t w = 0; w < mask.num_words(); ++w) {
+                if (words_ptr[w]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> operator!(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        {
+            if (empty(mask)) {
+                return Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(mask.header().dims().data(), mask.header().dims().size()));
+            const std::uint64_t* words_ptr{ mask.words() };
+            std::uint64_t* res_words_ptr{ res.words() };
+            for (std::int64_t w = 0; w < res.num_words(); ++w) {
+                res_words_ptr[w] = ~words_ptr[w];
+            }
+            res_words_ptr[res.num_words() - 1] &= res.last_word_mask();
+            return res;
+        }
+
+        /**
+        * @note Combines the words of two masks of the same dimensions by op.
+        * @return Empty mask if the dimensions are different.
+        */
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator, typename Binary_op>
+        [[nodiscard]] inline Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> combine(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
+        {
+            if (empty(lhs) || empty(rhs)) {
+                return Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (!std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
+                return Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(lhs.header().dims().data(), lhs.header().dims().size()));
+            const std::uint64_t* lhs_words_ptr{ lhs.words() };
+            const std::uint64_t* rhs_words_ptr{ rhs.words() };
+            std::uint64_t* res_words_ptr{ res.words() };
+            for (std::int64_t w = 0; w < res.num_words(); ++w) {
+                res_words_ptr[w] = op(lhs_words_ptr[w], rhs_words_ptr[w]);
+            }
+            return res;
+        }
+
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> operator&&(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return combine(lhs, rhs, std::bit_and<>{});
+        }
+
+        template <std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Bit_mask<Dims_capacity, Data_allocator, Internals_allocator> operator||(const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return combine(lhs, rhs, std::bit_or<>{});
+        }
+
+        /**
+        * @note Stream compaction of the positions selected by the bits of words, emitted by emit(first_position, bits, res_ptr)
+        * for every word with a selection, into a result sized by the popcount of the words.
+        * @return Empty array if no position is selected.
+        */
+        template <typename Res, typename Emit>
+        [[nodiscard]] inline Res compact(std::span<const std::uint64_t> words, Emit&& emit)
+        {
+            std::int64_t count{ 0 };
+            for (std::uint64_t word : words) {
+                count += std::popcount(word);
+            }
+            if (count == 0) {
+                return Res();
+            }
+
+            Res res({ count }, uninitialized);
+            auto res_ptr{ res.data() };
+            for (std::int64_t w = 0; w < std::ssize(words); ++w) {
+                if (words[w]) {
+                    res_ptr = emit(w * 64, words[w], res_ptr);
+                }
+            }
+            return res;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        {
+            if (empty(arr) || empty(mask)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (!std::equal(arr.header().dims().begin(), arr.header().dims().end(), mask.header().dims().begin(), mask.header().dims().end())) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> dense_arr{ arr.header().is_subarray() ? clone(arr) : arr };
+            const T* data_ptr{ dense_arr.data() };
+
+            return compact<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(std::span<const std::uint64_t>(mask.words(), mask.num_words()), [data_ptr](std::int64_t first, std::uint64_t bits, T* res_ptr) {
+                if constexpr (Simd_compressible<T>) {
+                    return simd_compress(data_ptr + first, bits, res_ptr);
+                }
+                else {
+                    for (; bits; bits &= bits - 1) {
+                        *res_ptr++ = data_ptr[first + std::countr_zero(bits)];
+                    }
+                    return res_ptr;
+                }
+            });
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Bit_mask<Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        {
+            if (empty(arr) || empty(mask)) {
+                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            if (!std::equal(arr.header().dims().begin(), arr.header().dims().end(), mask.header().dims().begin(), mask.header().dims().end())) {
+                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const auto& hdr{ arr.header() };
+            return compact<Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(std::span<const std::uint64_t>(mask.words(), mask.num_words()), [&hdr](std::int64_t first, std::uint64_t bits, std::int64_t* res_ptr) {
+                for (; bits; bits &= bits - 1) {
+                    const std::int64_t pos{ first + std::countr_zero(bits) };
+                    *res_ptr++ = hdr.is_subarray() ? pos2ind(hdr.offset(), hdr.strides(), hdr.dims(), pos) : pos;
+                }
+                return res_ptr;
+            });
+        }
+
+        template <typename T, typename Unary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_op&& op)
+            -> Array<decltype(op(arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(arr.data()[0]));
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()), uninitialized);
+
+            const T* arr_data_ptr{ arr.data() };
+            T_o* res_data_ptr{ res.data() };
+            const auto& hdr{ arr.header() };
+
+            policy.thread_pool().parallel_for(res.header().count(), policy.min_chunk_size, [&](std::int64_t begin, std::int64_t end) {
+                if (!hdr.is_subarray()) {
+                    for (std::int64_t i = begin; i < end; ++i) {
+                        res_data_ptr[i] = op(arr_data_ptr[i]);
+                    }
+                    return;
+                }
+                for (std::int64_t i = begin; i < end; ++i) {
+                    res_data_ptr[i] = op(arr_data_ptr[pos2ind(hdr.offset(), hdr.strides(), hdr.dims(), i)]);
+                }
+            });
+
+            return res;
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto transform(const Parallel_execution_policy& policy, const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            using T_o = decltype(op(lhs.data()[0], rhs.data()[0]));
+
+            if (!std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
+                simple_dims_vector<Dims_capacity, Internals_allocator> dims(std::max(lhs.header().dims().size(), rhs.header().dims().size()));
+                if (compute_broadcast_dims(lhs.header().dims(), rhs.header().dims(), dims) <= 0) {
+                    return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                }
+
+                Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(dims.data(), dims.size()), uninitialized);
+
+                const Array_header<Dims_capacity, Internals_allocator> lhs_hdr(lhs.header(), res.header().dims(), Broadcast_tag{});
+                const Array_header<Dims_capacity, Internals_allocator> rhs_hdr(rhs.header(), res.header().dims(), Broadcast_tag{});
+
+                policy.thread_pool().parallel_for(res.header().count(), policy.min_chunk_size, [&](std::int64_t begin, std::int64_t end) {
+                    broadcast_transform(lhs.data(), lhs_hdr, rhs.data(), rhs_hdr, res.data(), res.header(), begin, end, op);
+                });
+
+                return res;
+            }
+
+            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(lhs.header().dims().data(), lhs.header().dims().size()), uninitialized);
+
+            const T1* lhs_data_ptr{ lhs.data() };
+            const T2* rhs_data_ptr{ rhs.data() };
+            T_o* res_data_ptr{ res.data() };
+            const auto& lhs_hdr{ lhs.header() };
+            const auto& rhs_hdr{ rhs.header() };
+
+            policy.thread_pool().parallel_for(res.header().count(), policy.min_chunk_size, [&](std::int64_t begin, std::int64_t end) {
+                if (!lhs_hdr.is_subarray() && !rhs_hdr.is_subarray()) {
+                    std::int64_t i = begin;
+                    if constexpr (std::is_same_v<T1, T2> && Simd_binary_operation<T1, T_o, Binary_op>) {
+                        i += simd_transform(lhs_data_ptr + begin, rhs_data_ptr + begin, res_data_ptr + begin, end - begin, op);
+                    }
+                    for (; i < end; ++i) {
+                        res_data_ptr[i] = op(lhs_data_ptr[i], rhs_data_ptr[i]);
+                    }
+                    return;
+                }
+                for (std::int64_t i = begin; i < end; ++i) {
+                    res_data_ptr[i] = op(
+                        lhs_data_ptr[lhs_hdr.is_subarray() ? pos2ind(lhs_hdr.offset(), lhs_hdr.strides(), lhs_hdr.dims(), i) : i],
+                        rhs_data_ptr[rhs_hdr.is_subarray() ? pos2ind(rhs_hdr.offset(), rhs_hdr.strides(), rhs_hdr.dims(), i) : i]);
+                }
+            });
+
+            return res;
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto transform(const Parallel_execution_policy& policy, const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs.data()[0], rhs)), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            return transform(policy, lhs, [&rhs, &op](const T1& a) { return op(a, rhs); });
+        }
+
+        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto transform(const Parallel_execution_policy& policy, const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
+            -> Array<decltype(op(lhs, rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            return transform(policy, rhs, [&lhs, &op](const T2& b) { return op(lhs, b); });
+        }
+
+        /**
+        * @note The operation should be associative, since partial results of chunks are combined by it.
+        */
+        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op)
+            -> decltype(op(arr.data()[0], arr.data()[0]))
+        {
+            using T_o = decltype(op(arr.data()[0], arr.data()[0]));
+
+            if (empty(arr)) {
+                return T_o{};
+            }
+
+            const T* arr_data_ptr{ arr.data() };
+            const auto& hdr{ arr.header() };
+
+            Thread_pool& pool{ policy.thread_pool() };
+            const std::int64_t num_partials{ std::clamp<std::int64_t>(hdr.count() / std::max<std::int64_t>(policy.min_chunk_size, 1), 1, std::max<std::int64_t>(pool.size(), 1)) };
+            std::vector<std::optional<T_o>> partials(num_partials);
+
+            pool.parallel_for(num_partials, 1, [&](std::int64_t first_partial, std::int64_t last_partial) {
+                for (std::int64_t j = first_partial; j < last_partial; ++j) {
+                    const std::int64_t begin{ hdr.count() * j / num_partials };
+                    const std::int64_t end{ hdr.count() * (j + 1) / num_partials };
+
+                    auto element = [&](std::int64_t i) -> const T& {
+                        return arr_data_ptr[hdr.is_subarray() ? pos2ind(hdr.offset(), hdr.strides(), hdr.dims(), i) : i];
+                    };
+
+                    T_o res{ static_cast<T_o>(element(begin)) };
+                    for (std::int64_t i = begin + 1; i < end; ++i) {
+                        res = op(res, element(i));
+                    }
+                    partials[j] = std::move(res);
+                }
+            });
+
+            T_o res{ std::move(*partials[0]) };
+            for (std::int64_t j = 1; j < num_partials; ++j) {
+                res = op(res, *partials[j]);
+            }
+            return res;
+        }
+
+        /**
+        * @note The operation should be associative, since partial results of chunks are combined by it.
+        */
+        template <typename T, typename T_o, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const T_o& init_value, Binary_op&& op)
+            -> decltype(op(init_value, arr.data()[0]))
+        {
+            if (empty(arr)) {
+                return init_value;
+            }
+
+            return op(init_value, reduce(policy, arr, op));
+        }
+
+        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto reduce(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op, std::int64_t axis)
+            -> Array<decltype(op(arr.data()[0], arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        {
+            return reduce_axis(arr, std::forward<Binary_op>(op), axis, &policy);
+        }
+
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        {
+            return filter(arr, pred, &policy);
+        }
+
+        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        {
+            return find(arr, pred, &policy);
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> transpose(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> order)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), order);
+            if (new_header.empty()) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(new_header.dims(), uninitialized);
+
+            transpose_copy(arr.data(), arr.header(), order, res.data(), res.header(), nullptr);
+
+            return res;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> transpose(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> order)
+        {
+            return transpose(arr, std::span<const std::int64_t>(order.begin(), order.size() ));
+        }
+
+        /**
+        * @note Blocks of the transposed planes are copied in parallel by the policy's thread pool.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> transpose(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> order)
+        {
+            if (empty(arr)) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), order);
+            if (new_header.empty()) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(new_header.dims(), uninitialized);
+
+            transpose_copy(arr.data(), arr.header(), order, res.data(), res.header(), &policy);
+
+            return res;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> transpose(const Parallel_execution_policy& policy, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> order)
+        {
+            return transpose(policy, arr, std::span<const std::int64_t>(order.begin(), order.size()));
+        }
+
+
+
+        /*
+        * Memory-mapped arrays:
+        * =====================
+        *
+        * map_file() creates an array whose buffer is a memory mapping of a file region, so that elements are paged in
+        * on access instead of being read up front. The mapping is shared by all the arrays and subarrays created from
+        * the mapped array, and unmapped when the last of them is destroyed. Growing the array copies it to the heap.
+        */
+
+        enum class Map_mode {
+            read_only, // writing to the elements is not allowed
+            copy_on_write, // written pages are private to the process, and never written to the file
+        };
+
+        enum class Access_advice {
+            normal,
+            sequential,
+            random,
+            will_need,
+            dont_need,
+        };
+
+#if defined(__unix__)
+        /**
+        * @note Release function of the buffer of mapped arrays, which also describes the mapping.
+        */
+        struct File_mapping {
+            void* base{ nullptr };
+            std::size_t size{ 0 };
+            bool is_private{ false };
+
+            template <typename T, typename Size>
+            void operator()(T*, Size) const noexcept
+            {
+                ::munmap(base, size);
+            }
+        };
+
+        /**
+        * @param byte_offset Position of the first element in the file, which should be aligned to the element type.
+        * @return A dense array viewing the file elements in row-major order, or an empty array if the file cannot be mapped
+        * or is too small for the requested dimensions.
+        */
+        template <typename T, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        requires (std::is_trivially_copyable_v<T>)
+        [[nodiscard]] inline Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator> map_file(const std::string& path, std::span<const std::int64_t> dims, std::int64_t byte_offset = 0, Map_mode mode = Map_mode::read_only)
+        {
+            const std::int64_t count{ numel(dims) };
+            if (count <= 0 || byte_offset < 0 || byte_offset % alignof(T) != 0) {
+                return Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            int fd{ ::open(path.c_str(), O_RDONLY) };
+            if (fd < 0) {
+                return Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            struct stat st {};
+            const std::int64_t num_bytes{ count * static_cast<std::int64_t>(sizeof(T)) };
+            if (::fstat(fd, &st) != 0 || st.st_size < byte_offset + num_bytes) {
+                ::close(fd);
+                return Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            const std::int64_t page_size{ ::sysconf(_SC_PAGESIZE) };
+            const std::int64_t map_offset{ byte_offset - byte_offset % page_size };
+            const std::size_t map_size{ static_cast<std::size_t>(byte_offset - map_offset + num_bytes) };
+
+            void* base{ mode == Map_mode::read_only
+                ? ::mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, map_offset)
+                : ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, map_offset) };
+            ::close(fd);
+            if (base == MAP_FAILED) {
+                return Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator>();
+            }
+
+            T* data{ reinterpret_cast<T*>(static_cast<char*>(base) + (byte_offset - map_offset)) };
+
+            return Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator>(dims, data, File_mapping{ base, map_size, mode == Map_mode::copy_on_write });
+        }
+
+        template <typename T, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        requires (std::is_trivially_copyable_v<T>)
+        [[nodiscard]] inline Array<T, dynamic_sequence, Dims_capacity, Data_allocator, Internals_allocator> map_file(const std::string& path, std::initializer_list<std::int64_t> dims, std::int64_t byte_offset = 0, Map_mode mode = Map_mode::read_only)
+        {
+            return map_file<T, Dims_capacity, Data_allocator, Internals_allocator>(path, std::span<const std::int64_t>(dims.begin(), dims.size()), byte_offset, mode);
+        }
+
+        /**
+        * @note Hints the kernel about the access pattern of the pages spanned by the array elements (see madvise).
+        * Only the pages of the file mapping are advised. Since dont_need discards the written pages of private mappings,
+        * it is only accepted for read-only mappings.
+        * @return True if the advice was accepted, false if the array is not mapped from a file.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline bool advise(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Access_advice advice)
+        {
+            const File_mapping* mapping{ arr.template release_target<File_mapping>() };
+            if (empty(arr) || !mapping || (advice == Access_advice::dont_need && mapping->is_private)) {
+                return false;
             }
 
-            [[nodiscard]] const T& operator()(std::span<std::int64_t> subs) const noexcept
-            {
-                return buffsp_->data()[subs2ind(hdr_.offset(), hdr_.strides(), hdr_.dims(), subs)];
+            const std::uintptr_t page_size{ static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE)) };
+            const std::uintptr_t base{ reinterpret_cast<std::uintptr_t>(mapping->base) };
+            const std::uintptr_t first{ reinterpret_cast<std::uintptr_t>(arr.data() + arr.header().offset()) };
+            const std::uintptr_t last{ std::min(reinterpret_cast<std::uintptr_t>(arr.data() + arr.header().last_index() + 1), base + mapping->size) };
+            const std::uintptr_t aligned_first{ std::max(first - first % page_size, base) };
+            if (aligned_first >= last) {
+                return false;
             }
-            [[nodiscard]] const T& operator()(std::initializer_list<std::int64_t> subs) const noexcept
-            {
-                return (*this)(std::span<std::int64_t>{ const_cast<std::int64_t*>(subs.begin()), subs.size() });
+
+            int flag{ MADV_NORMAL };
+            switch (advice) {
+            case Access_advice::sequential: flag = MADV_SEQUENTIAL; break;
+            case Access_advice::random: flag = MADV_RANDOM; break;
+            case Access_advice::will_need: flag = MADV_WILLNEED; break;
+            case Access_advice::dont_need: flag = MADV_DONTNEED; break;
+            default: break;
             }
 
-            [[nodiscard]] T& operator()(std::span<std::int64_t> subs) noexcept
-            {
-                return buffsp_->data()[subs2ind(hdr_.offset(), hdr_.strides(), hdr_.dims(), subs)];
+            return ::madvise(reinterpret_cast<void*>(aligned_first), last - aligned_first, flag) == 0;
+        }
+#endif
+
+
+        /*
+        * Binary serialization:
+        * =====================
+        *
+        * Arrays are saved in the NumPy .npy format (version 1.0): a magic string, a little-endian header length and an
+        * ASCII header describing the element type, the memory order and the shape, followed by the raw elements in row-major order.
+        * Npy_writer and Npy_reader stream one slice of axis 0 at a time, for arrays that are larger than the memory.
+        */
+
+        /**
+        * @return The .npy type descriptor of T (e.g. '<f8'), or an empty string if T has no descriptor.
+        */
+        template <typename T>
+        [[nodiscard]] inline std::string npy_descr()
+        {
+            const char byte_order{ std::endian::native == std::endian::little ? '<' : '>' };
+            char kind{ '\0' };
+            if constexpr (std::is_same_v<T, bool>) {
+                kind = 'b';
             }
-            [[nodiscard]] T& operator()(std::initializer_list<std::int64_t> subs) noexcept
-            {
-                return (*this)(std::span<std::int64_t>{ const_cast<std::int64_t*>(subs.begin()), subs.size() });
+            else if constexpr (std::is_floating_point_v<T>) {
+                kind = 'f';
+            }
+            else if constexpr (std::is_integral_v<T>) {
+                kind = std::is_signed_v<T> ? 'i' : 'u';
             }
+            else {
+                return std::string{};
+            }
+            return std::string{ sizeof(T) == 1 ? '|' : byte_order, kind } + std::to_string(sizeof(T));
+        }
 
-            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(std::span<const Interval<std::int64_t>> ranges) const
-            {
-                if (ranges.empty() || empty(*this)) {
-                    return (*this);
-                }
+        inline constexpr char npy_magic[]{ '\x93', 'N', 'U', 'M', 'P', 'Y' };
 
-                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> slice{};
-                slice.hdr_ = Header{ hdr_, ranges };
-                slice.buffsp_ = slice.hdr_.empty() ? nullptr : buffsp_;
-                return slice;
+        inline bool write_npy_header(std::ostream& os, const std::string& descr, std::span<const std::int64_t> dims)
+        {
+            std::string header{ "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (" };
+            for (std::size_t i = 0; i < dims.size(); ++i) {
+                header += (i > 0 ? ", " : "") + std::to_string(dims[i]);
             }
-            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(std::initializer_list<Interval<std::int64_t>> ranges) const
-            {
-                return (*this)(std::span<const Interval<std::int64_t>>{ranges.begin(), ranges.size()});
+            header += dims.size() == 1 ? ",), }" : "), }";
+
+            // the header is padded with spaces and terminated by a new line, so that the data is 64-byte aligned
+            const std::size_t preamble_size{ sizeof(npy_magic) + 4 };
+            header.append(64 - (preamble_size + header.size() + 1) % 64, ' ');
+            header += '\n';
+
+            if (header.size() > std::numeric_limits<std::uint16_t>::max()) {
+                return false;
             }
 
-            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator()(const Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& indices) const noexcept
-            {
-                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(indices.header().dims().data(), indices.header().dims().size()));
+            const std::uint16_t header_size{ static_cast<std::uint16_t>(header.size()) };
+            const char preamble[]{ '\x01', '\x00', static_cast<char>(header_size & 0xff), static_cast<char>(header_size >> 8) };
 
-                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(indices.header()); gen; ++gen) {
-                    res(*gen) = buffsp_->data()[indices(*gen)];
-                }
+            os.write(npy_magic, sizeof(npy_magic));
+            os.write(preamble, sizeof(preamble));
+            os.write(header.data(), header.size());
+            return static_cast<bool>(os);
+        }
 
-                return res;
+        /**
+        * @param[out] dims Dimensions of the saved array. A zero dimensional array is read as a single element array.
+        * @return True if a valid header was read.
+        */
+        template <typename Dims_vector>
+        inline bool read_npy_header(std::istream& is, std::string& descr, bool& fortran_order, Dims_vector& dims)
+        {
+            char preamble[sizeof(npy_magic) + 2]{};
+            if (!is.read(preamble, sizeof(preamble)) || !std::equal(npy_magic, npy_magic + sizeof(npy_magic), preamble)) {
+                return false;
             }
 
-            template <typename T_o, typename Binary_op>
-            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& transform(const Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& other, Binary_op&& op)
-            {
-                if (!std::equal(header().dims().begin(), header().dims().end(), other.header().dims().begin(), other.header().dims().end())) {
-                    return *this;
-                }
-
-                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(header()); gen; ++gen) {
-                    (*this)(*gen) = op((*this)(*gen), other(*gen));
-                }
+            const std::uint8_t major_version{ static_cast<std::uint8_t>(preamble[sizeof(npy_magic)]) };
+            unsigned char size_bytes[4]{};
+            const std::size_t num_size_bytes{ major_version == 1 ? 2u : 4u };
+            if (major_version < 1 || major_version > 3 || !is.read(reinterpret_cast<char*>(size_bytes), num_size_bytes)) {
+                return false;
+            }
+            const std::size_t header_size{ size_bytes[0] | (size_bytes[1] << 8) | (size_bytes[2] << 16) | (static_cast<std::size_t>(size_bytes[3]) << 24) };
 
-                return *this;
+            std::string header(header_size, '\0');
+            if (!is.read(header.data(), header_size)) {
+                return false;
             }
 
-            template <typename T_o, typename Binary_op>
-            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& transform(const T_o& other, Binary_op&& op)
-            {
-                for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(header()); gen; ++gen) {
-                    (*this)(*gen) = op((*this)(*gen), other);
+            auto value_of = [&header](const std::string& key) -> std::string_view {
+                std::size_t pos{ header.find("'" + key + "'") };
+                if (pos == std::string::npos || (pos = header.find(':', pos)) == std::string::npos) {
+                    return std::string_view{};
                 }
+                pos = header.find_first_not_of(' ', pos + 1);
+                return pos == std::string::npos ? std::string_view{} : std::string_view(header).substr(pos);
+            };
 
-                return *this;
+            std::string_view descr_value{ value_of("descr") };
+            if (descr_value.size() < 2 || descr_value[0] != '\'') {
+                return false;
             }
+            descr = std::string(descr_value.substr(1, descr_value.find('\'', 1) - 1));
 
-            auto begin(std::int64_t axis = 0)
-            {
-                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis));
+            std::string_view order_value{ value_of("fortran_order") };
+            if (order_value.starts_with("True")) {
+                fortran_order = true;
             }
-
-            auto end(std::int64_t axis = 0)
-            {
-                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis, true) + 1);
+            else if (order_value.starts_with("False")) {
+                fortran_order = false;
+            }
+            else {
+                return false;
             }
 
+            std::string_view shape_value{ value_of("shape") };
+            if (shape_value.empty() || shape_value[0] != '(' || shape_value.find(')') == std::string_view::npos) {
+                return false;
+            }
+            shape_value = shape_value.substr(1, shape_value.find(')') - 1);
 
-            auto cbegin(std::int64_t axis = 0) const
-            {
-                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis));
+            std::int64_t ndims{ 0 };
+            std::int64_t parsed_dims[64]{};
+            while (!shape_value.empty()) {
+                shape_value.remove_prefix(std::min(shape_value.find_first_not_of(", "), shape_value.size()));
+                if (shape_value.empty()) {
+                    break;
+                }
+                if (ndims == std::ssize(parsed_dims)) {
+                    return false;
+                }
+                auto [ptr, ec] { std::from_chars(shape_value.data(), shape_value.data() + shape_value.size(), parsed_dims[ndims]) };
+                if (ec != std::errc{}) {
+                    return false;
+                }
+                shape_value.remove_prefix(ptr - shape_value.data());
+                ++ndims;
             }
 
-            auto cend(std::int64_t axis = 0) const
-            {
-                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data() , Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis, true) + 1);
+            if (ndims == 0) {
+                parsed_dims[ndims++] = 1;
             }
 
+            dims = Dims_vector(ndims);
+            std::copy_n(parsed_dims, ndims, dims.data());
+            return true;
+        }
 
-            auto rbegin(std::int64_t axis = 0)
-            {
-                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis, true));
-            }
+        inline constexpr std::int64_t npy_gather_buffer_size{ 65536 };
 
-            auto rend(std::int64_t axis = 0)
-            {
-                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis) - 1);
+        /**
+        * @note Dense arrays are written by a single write, and subarrays are gathered run by run into a buffer of at most
+        * npy_gather_buffer_size bytes, which is written whenever it is full.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline bool write_npy_elements(std::ostream& os, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            if (!arr.header().is_subarray()) {
+                os.write(reinterpret_cast<const char*>(arr.data()), arr.header().count() * sizeof(T));
+                return static_cast<bool>(os);
+            }
+
+            const std::int64_t buffer_count{ std::max<std::int64_t>(npy_gather_buffer_size / static_cast<std::int64_t>(sizeof(T)), 1) };
+            simple_vector<T, dynamic_sequence, Data_allocator> buffer(std::min(buffer_count, arr.header().count()));
+            std::int64_t buffered{ 0 };
+
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; gen.next_run()) {
+                const T* run_ptr{ arr.data() + *gen };
+                const std::int64_t run_stride{ gen.run_stride() };
+                const std::int64_t run_length{ gen.run_length() };
+                for (std::int64_t i = 0; i < run_length; ++i) {
+                    buffer[buffered++] = run_ptr[i * run_stride];
+                    if (buffered == buffer.size()) {
+                        os.write(reinterpret_cast<const char*>(buffer.data()), buffered * sizeof(T));
+                        buffered = 0;
+                    }
+                }
             }
+            os.write(reinterpret_cast<const char*>(buffer.data()), buffered * sizeof(T));
+            return static_cast<bool>(os);
+        }
 
-            auto crbegin(std::int64_t axis = 0) const
-            {
-                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis, true));
+        /**
+        * @return True if the array was saved. Empty arrays and element types without a .npy descriptor are not saved.
+        */
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline bool save(const std::string& path, const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            if (empty(arr) || npy_descr<T>().empty()) {
+                return false;
             }
 
-            auto crend(std::int64_t axis = 0) const
-            {
-                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, axis) - 1);
-            }
+            std::ofstream ofs(path, std::ios::binary);
+            return ofs && write_npy_header(ofs, npy_descr<T>(), arr.header().dims()) && write_npy_elements(ofs, arr);
+        }
 
+        /**
+        * @return The loaded array, or an empty array if the file cannot be read or its element type is not T.
+        * @note Arrays saved in column-major (Fortran) order are transposed into row-major order.
+        */
+        template <typename T, std::int64_t Data_capacity = dynamic_sequence, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> load(const std::string& path)
+        {
+            std::ifstream ifs(path, std::ios::binary);
 
-            auto begin(std::span<const std::int64_t> order)
-            {
-                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order));
+            std::string descr;
+            bool fortran_order{ false };
+            simple_dims_vector<Dims_capacity, Internals_allocator> dims;
+            if (!ifs || !read_npy_header(ifs, descr, fortran_order, dims) || descr != npy_descr<T>() || numel(dims) <= 0) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
             }
 
-            auto end(std::span<const std::int64_t> order)
-            {
-                return Array_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order, true) + 1);
+            if (fortran_order) {
+                std::reverse(dims.begin(), dims.end());
             }
 
-
-            auto cbegin(std::span<const std::int64_t> order) const
-            {
-                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order));
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> arr(std::span<const std::int64_t>(dims.data(), dims.size()), uninitialized);
+            if (!ifs.read(reinterpret_cast<char*>(arr.data()), arr.header().count() * sizeof(T))) {
+                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
             }
 
-            auto cend(std::span<const std::int64_t> order) const
-            {
-                return Array_const_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order, true) + 1);
+            if (fortran_order && dims.size() > 1) {
+                simple_dims_vector<Dims_capacity, Internals_allocator> order(dims.size());
+                std::iota(order.begin(), order.end(), std::int64_t{ 0 });
+                std::reverse(order.begin(), order.end());
+                return transpose(arr, std::span<const std::int64_t>(order.data(), order.size()));
             }
 
+            return arr;
+        }
 
-            auto rbegin(std::span<const std::int64_t> order)
+        /**
+        * @note Writes an array of the given dimensions one slice of axis 0 at a time. The header is written on construction,
+        * so that the file is a valid .npy file once all the dims[0] slices are written.
+        */
+        template <typename T, std::int64_t Data_capacity = dynamic_sequence, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        class Npy_writer final {
+        public:
+            Npy_writer(const std::string& path, std::span<const std::int64_t> dims)
+                : ofs_(path, std::ios::binary), hdr_(dims)
             {
-                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order, true));
+                if (hdr_.empty() || npy_descr<T>().empty() || !write_npy_header(ofs_, npy_descr<T>(), dims)) {
+                    ofs_.setstate(std::ios::failbit);
+                }
             }
 
-            auto rend(std::span<const std::int64_t> order)
+            Npy_writer(const std::string& path, std::initializer_list<std::int64_t> dims)
+                : Npy_writer(path, std::span<const std::int64_t>(dims.begin(), dims.size()))
             {
-                return Array_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order) - 1);
             }
 
-            auto crbegin(std::span<const std::int64_t> order) const
+            /**
+            * @param slice Array with the dimensions of the array omitting axis 0, or a single element array for one dimensional arrays.
+            * @return True if the slice was written.
+            */
+            bool write(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& slice)
             {
-                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order, true));
-            }
+                const Array_header<Dims_capacity, Internals_allocator> slice_hdr(hdr_, 0);
+                if (!*this || !std::equal(slice_hdr.dims().begin(), slice_hdr.dims().end(), slice.header().dims().begin(), slice.header().dims().end())) {
+                    return false;
+                }
 
-            auto crend(std::span<const std::int64_t> order) const
-            {
-                return Array_const_reverse_iterator<T, Dims_capacity, Internals_allocator>(buffsp_->data(), Array_indices_generator<Dims_capacity, Internals_allocator>(hdr_, order) - 1);
+                if (!write_npy_elements(ofs_, slice)) {
+                    return false;
+                }
+                ++num_written_;
+                return true;
             }
 
-
-
-            auto begin(std::initializer_list<std::int64_t> order)
+            [[nodiscard]] std::int64_t num_written() const noexcept
             {
-                return begin(std::span<const std::int64_t>(order.begin(), order.size()));
+                return num_written_;
             }
 
-            auto end(std::initializer_list<std::int64_t> order)
+            /**
+            * @return True if the writer is valid and not all the slices were written.
+            */
+            [[nodiscard]] explicit operator bool() const noexcept
             {
-                return end(std::span<const std::int64_t>(order.begin(), order.size()));
+                return static_cast<bool>(ofs_) && num_written_ < hdr_.dims()[0];
             }
 
+        private:
+            std::ofstream ofs_;
+            Array_header<Dims_capacity, Internals_allocator> hdr_;
+            std::int64_t num_written_{ 0 };
+        };
 
-            auto cbegin(std::initializer_list<std::int64_t> order) const
-            {
-                return cbegin(std::span<const std::int64_t>(order.begin(), order.size()));
+        /**
+        * @note Reads a row-major .npy array one slice of axis 0 at a time.
+        */
+        template <typename T, std::int64_t Data_capacity = dynamic_sequence, std::int64_t Dims_capacity = dynamic_sequence, template<typename> typename Data_allocator = Lightweight_stl_allocator, template<typename> typename Internals_allocator = Lightweight_stl_allocator>
+        class Npy_reader final {
+        public:
+            Npy_reader(const std::string& path)
+                : ifs_(path, std::ios::binary)
+            {
+                std::string descr;
+                bool fortran_order{ false };
+                simple_dims_vector<Dims_capacity, Internals_allocator> dims;
+                if (!ifs_ || !read_npy_header(ifs_, descr, fortran_order, dims) || descr != npy_descr<T>() || fortran_order) {
+                    ifs_.setstate(std::ios::failbit);
+                    return;
+                }
+                hdr_ = Array_header<Dims_capacity, Internals_allocator>(std::span<const std::int64_t>(dims.data(), dims.size()));
+                slice_hdr_ = Array_header<Dims_capacity, Internals_allocator>(hdr_, 0);
             }
 
-            auto cend(std::initializer_list<std::int64_t> order) const
+            [[nodiscard]] std::span<const std::int64_t> dims() const noexcept
             {
-                return cend(std::span<const std::int64_t>(order.begin(), order.size()));
+                return hdr_.dims();
             }
 
-
-            auto rbegin(std::initializer_list<std::int64_t> order)
+            /**
+            * @return The next slice, or an empty array if all the slices were read or the file cannot be read.
+            */
+            [[nodiscard]] Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> read()
             {
-                return rbegin(std::span<const std::int64_t>(order.begin(), order.size()));
-            }
+                if (!*this) {
+                    return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                }
 
-            auto rend(std::initializer_list<std::int64_t> order)
-            {
-                return rend(std::span<const std::int64_t>(order.begin(), order.size()));
+                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> slice(slice_hdr_.dims(), uninitialized);
+                if (!ifs_.read(reinterpret_cast<char*>(slice.data()), slice.header().count() * sizeof(T))) {
+                    return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
+                }
+                ++num_read_;
+                return slice;
             }
 
-            auto crbegin(std::initializer_list<std::int64_t> order) const
+            [[nodiscard]] std::int64_t num_read() const noexcept
             {
-                return crbegin(std::span<const std::int64_t>(order.begin(), order.size()));
+                return num_read_;
             }
 
-            auto crend(std::initializer_list<std::int64_t> order) const
+            /**
+            * @return True if the reader is valid and not all the slices were read.
+            */
+            [[nodiscard]] explicit operator bool() const noexcept
             {
-                return crend(std::span<const std::int64_t>(order.begin(), order.size()));
+                return static_cast<bool>(ifs_) && !hdr_.empty() && num_read_ < hdr_.dims()[0];
             }
 
-
         private:
-            Header hdr_{};
-            std::shared_ptr<simple_vector<T, Data_capacity, Data_allocator>> buffsp_{ nullptr };
+            std::ifstream ifs_;
+            Array_header<Dims_capacity, Internals_allocator> hdr_;
+            Array_header<Dims_capacity, Internals_allocator> slice_hdr_;
+            std::int64_t num_read_{ 0 };
         };
 
-        /**
-        * @note Copy is being performed even if dimensions are not match either partialy or by indices modulus.
-        */
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline void copy(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& src, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& dst)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator==(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(src) || empty(dst)) {
-                return;
-            }
-
-            Array_indices_generator<Dims_capacity, Internals_allocator> src_gen(src.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> dst_gen(dst.header());
+            return transform(lhs, rhs, std::equal_to<>{});
+        }
 
-            for (; src_gen && dst_gen; ++src_gen, ++dst_gen) {
-                dst(*dst_gen) = src(*src_gen);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator==(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::equal_to<>{});
         }
+
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline void copy(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& src, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& dst)
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator==(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            copy(src, dst);
+            return transform(lhs, rhs, std::equal_to<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> clone(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator!=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(lhs, rhs, std::not_equal_to<>{});
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> clone(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator!=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::not_equal_to<>{});
+        }
 
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; ++gen) {
-                clone(*gen) = arr(*gen);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator!=(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::not_equal_to<>{});
+        }
 
-            return clone;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{})>(), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{})>())
+        {
+            return transform(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
         }
 
-        /**
-        * @note Returning a reference to the input array, except in case of resulted empty array or an input subarray.
-        */
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> reshape(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> new_dims)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+        }
 
-            if (arr.header().dims() == new_dims) {
-                return arr;
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> close(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
+        {
+            return transform(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+        }
 
-            if (arr.header().count() != numel(new_dims)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::greater<>{});
+        }
 
-            if (arr.header().is_subarray()) {
-                Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(new_dims.data(), new_dims.size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::greater<>{});
+        }
 
-                Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
-                Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::greater<>{});
+        }
 
-                while (arr_gen && res_gen) {
-                    res(*res_gen) = arr(*arr_gen);
-                    ++arr_gen;
-                    ++res_gen;
-                }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::greater_equal<>{});
+        }
 
-                return res;
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::greater_equal<>{});
+        }
 
-            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(new_dims);
-            if (new_header.empty()) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>=(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::greater_equal<>{});
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(arr);
-            res.header() = std::move(new_header);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::less<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::less<>{});
         }
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> reshape(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> new_dims)
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return reshape(arr, std::span<const std::int64_t>(new_dims.begin(), new_dims.size()));
+            return transform(lhs, rhs, std::less<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> resize(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> new_dims)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>(std::span<const std::int64_t>(new_dims.data(), new_dims.size()));
-            }
+            return transform(lhs, rhs, std::less_equal<>{});
+        }
 
-            if (arr.header().dims() == new_dims) {
-                return clone(arr);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::less_equal<>{});
+        }
 
-            if (numel(new_dims) <= 0) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<=(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::less_equal<>{});
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(new_dims.data(), new_dims.size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator+(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::plus<>{});
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator+(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::plus<>{});
+        }
 
-            while (arr_gen && res_gen) {
-                res(*res_gen) = arr(*arr_gen);
-                ++arr_gen;
-                ++res_gen;
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator+(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::plus<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator+(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), std::plus<>{});
         }
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> resize(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> new_dims)
+
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator+(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            return resize(arr, std::span<const std::int64_t>(new_dims.begin(), new_dims.size()));
+            return transform(lhs, rhs, std::plus<>{});
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> append(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator+(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            if (empty(lhs)) {
-                return clone(rhs);
-            }
+            return transform(std::move(lhs), rhs, std::plus<>{});
+        }
 
-            if (empty(rhs)) {
-                return clone(lhs);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator+(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::plus<>{});
+        }
 
-            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(resize(lhs, { lhs.header().count() + rhs.header().count() }));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator+(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::plus<>{});
+        }
 
-            Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rrhs(reshape(rhs, { rhs.header().count() }));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator+=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::plus<>{});
+        }
 
-            for (std::int64_t i = lhs.header().count(); i < res.header().count(); ++i) {
-                res({ i }) = rhs({ i - lhs.header().count() });
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator+=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, std::plus<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator-(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::minus<>{});
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> append(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, std::int64_t axis)
+        [[nodiscard]] inline auto operator-(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(lhs)) {
-                return clone(rhs);
-            }
+            return transform(std::move(lhs), rhs, std::minus<>{});
+        }
 
-            if (empty(rhs)) {
-                return clone(lhs);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator-(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::minus<>{});
+        }
 
-            typename Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(lhs.header(), rhs.header().dims(), axis);
-            if (new_header.empty()) {
-                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>{};
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator-(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), std::minus<>{});
+        }
 
-            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() });
-            res.header() = std::move(new_header);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator-(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::minus<>{});
+        }
 
-            std::int64_t fixed_axis{ modulo(axis, std::ssize(lhs.header().dims())) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator-(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::minus<>{});
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header(), fixed_axis);
-            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header(), fixed_axis);
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header(), fixed_axis);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator-(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::minus<>{});
+        }
 
-            for (; lhs_gen && res_gen; ++lhs_gen, ++res_gen) {
-                res.data()[*res_gen] = lhs.data()[*lhs_gen];
-            }
-            for (; rhs_gen && res_gen; ++rhs_gen, ++res_gen) {
-                res.data()[*res_gen] = rhs.data()[*rhs_gen];
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator-(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::minus<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator-=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::minus<>{});
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> insert(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, std::int64_t ind)
+        inline auto& operator-=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            if (empty(lhs)) {
-                return clone(rhs);
-            }
+            return lhs.transform(rhs, std::minus<>{});
+        }
 
-            if (empty(rhs)) {
-                return clone(lhs);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator*(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::multiplies<>{});
+        }
 
-            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() });
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator*(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::multiplies<>{});
+        }
 
-            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rlhs(reshape(lhs, { lhs.header().count() }));
-            Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rrhs(reshape(rhs, { rhs.header().count() }));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator*(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::multiplies<>{});
+        }
 
-            std::int64_t fixed_ind{ modulo(ind, lhs.header().count() + 1) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator*(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), std::multiplies<>{});
+        }
 
-            for (std::int64_t i = 0; i < fixed_ind; ++i) {
-                res({ i }) = rlhs({ i });
-            }
-            for (std::int64_t i = 0; i < rhs.header().count(); ++i) {
-                res({ fixed_ind + i }) = rrhs({ i });
-            }
-            for (std::int64_t i = 0; i < lhs.header().count() - fixed_ind; ++i) {
-                res({ fixed_ind + rhs.header().count() + i }) = rlhs({ fixed_ind + i });
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator*(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::multiplies<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator*(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::multiplies<>{});
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> insert(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, std::int64_t ind, std::int64_t axis)
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator*(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(lhs)) {
-                return clone(rhs);
-            }
+            return transform(lhs, rhs, std::multiplies<>{});
+        }
 
-            if (empty(rhs)) {
-                return clone(lhs);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator*(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::multiplies<>{});
+        }
 
-            typename Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(lhs.header(), rhs.header().dims(), axis);
-            if (new_header.empty()) {
-                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator*=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::multiplies<>{});
+        }
 
-            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ lhs.header().count() + rhs.header().count() });
-            res.header() = std::move(new_header);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator*=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, std::multiplies<>{});
+        }
 
-            std::int64_t fixed_axis{ modulo(axis, std::ssize(lhs.header().dims())) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator/(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::divides<>{});
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header(), fixed_axis);
-            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header(), fixed_axis);
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header(), fixed_axis);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator/(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::divides<>{});
+        }
 
-            std::int64_t fixed_ind{ modulo(ind, lhs.header().dims()[fixed_axis]) };
-            std::int64_t cycle = fixed_ind *
-                (std::accumulate(res.header().dims().begin(), res.header().dims().end(), 1, std::multiplies<>{}) / res.header().dims()[fixed_axis]);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator/(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::divides<>{});
+        }
 
-            for (; lhs_gen && res_gen && cycle; --cycle, ++lhs_gen, ++res_gen) {
-                res.data()[*res_gen] = lhs.data()[*lhs_gen];
-            }
-            for (; rhs_gen && res_gen; ++rhs_gen, ++res_gen) {
-                res.data()[*res_gen] = rhs.data()[*rhs_gen];
-            }
-            for (; lhs_gen && res_gen; ++lhs_gen, ++res_gen) {
-                res.data()[*res_gen] = lhs.data()[*lhs_gen];
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator/(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), std::divides<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator/(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::divides<>{});
         }
 
-        /**
-        * @note All elements starting from ind are being removed in case that count value is too big.
-        */
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> remove(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t ind, std::int64_t count)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator/(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(std::move(lhs), rhs, std::divides<>{});
+        }
 
-            std::int64_t fixed_ind{ modulo(ind, arr.header().count()) };
-            std::int64_t fixed_count{ fixed_ind + count < arr.header().count() ? count : (arr.header().count() - fixed_ind) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator/(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::divides<>{});
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() - fixed_count });
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> rarr(reshape(arr, { arr.header().count() }));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator/(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::divides<>{});
+        }
 
-            for (std::int64_t i = 0; i < fixed_ind; ++i) {
-                res({ i }) = rarr({ i });
-            }
-            for (std::int64_t i = fixed_ind + fixed_count; i < arr.header().count(); ++i) {
-                res({ i - fixed_count }) = rarr({ i });
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator/=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::divides<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator/=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, std::divides<>{});
         }
 
-        /**
-        * @note All elements starting from ind are being removed in case that count value is too big.
-        */
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> remove(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t ind, std::int64_t count, std::int64_t axis)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto operator%(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            std::int64_t fixed_axis{ modulo(axis, std::ssize(arr.header().dims())) };
-            std::int64_t fixed_ind{ modulo(ind, arr.header().dims()[fixed_axis]) };
-            std::int64_t fixed_count{ fixed_ind + count <= arr.header().dims()[fixed_axis] ? count : (arr.header().dims()[fixed_axis] - fixed_ind) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto operator%(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), -fixed_count, fixed_axis);
-            if (new_header.empty()) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto operator%(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() - (arr.header().count() / arr.header().dims()[fixed_axis]) * fixed_count });
-            res.header() = std::move(new_header);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto operator%(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header(), fixed_axis);
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header(), fixed_axis);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator%(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            std::int64_t cycle = fixed_ind *
-                (std::accumulate(res.header().dims().begin(), res.header().dims().end(), 1, std::multiplies<>{}) / res.header().dims()[fixed_axis]);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator%(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
+        {
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            std::int64_t removals = arr.header().count() - res.header().count();
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator%(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            for (; arr_gen && res_gen && cycle; --cycle, ++arr_gen, ++res_gen) {
-                res.data()[*res_gen] = arr.data()[*arr_gen];
-            }
-            for (; arr_gen && removals; --removals, ++arr_gen) {
-                //arr.data()[*arr_gen] = rhs.data()[*rhs_gen];
-            }
-            for (; arr_gen && res_gen; ++arr_gen, ++res_gen) {
-                res.data()[*res_gen] = arr.data()[*arr_gen];
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator%(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a % b; });
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator%=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a % b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool empty(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr) noexcept
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator%=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            return !arr.data() && arr.header().empty();
+            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a % b; });
         }
 
-        template <typename T, typename Unary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>    
-        [[nodiscard]] inline auto transform(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_op&& op)
-            -> Array<decltype(op(arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator^(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            using T_o = decltype(op(arr.data()[0]));
+            return transform(lhs, rhs, std::bit_xor<>{});
+        }
 
-            if (empty(arr)) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator^(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::bit_xor<>{});
+        }
 
-            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(arr.header().dims().data(), arr.header().dims().size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator^(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::bit_xor<>{});
+        }
 
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; ++gen) {
-                res(*gen) = op(arr(*gen));
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator^(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), std::bit_xor<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator^(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::bit_xor<>{});
         }
 
-        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op)
-            -> decltype(op(arr.data()[0], arr.data()[0]))
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator^(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            using T_o = decltype(op(arr.data()[0], arr.data()[0]));
+            return transform(std::move(lhs), rhs, std::bit_xor<>{});
+        }
 
-            if (empty(arr)) {
-                return T_o{};
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator^(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::bit_xor<>{});
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> gen{ arr.header() };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator^(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::bit_xor<>{});
+        }
 
-            T_o res{ static_cast<T_o>(arr(*gen)) };
-            ++gen;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator^=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::bit_xor<>{});
+        }
 
-            while (gen) {
-                res = op(res, arr(*gen));
-                ++gen;
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator^=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, std::bit_xor<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::bit_and<>{});
         }
 
-        template <typename T, typename T_o, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const T_o& init_value, Binary_op&& op)
-            -> decltype(op(init_value, arr.data()[0]))
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator&(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            if (empty(arr)) {
-                return init_value;
-            }
+            return transform(std::move(lhs), rhs, std::bit_and<>{});
+        }
 
-            T_o res{ init_value };
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen{ arr.header() }; gen; ++gen) {
-                res = op(res, arr(*gen));
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::bit_and<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator&(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), std::bit_and<>{});
         }
 
-        template <typename T, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Binary_op&& op, std::int64_t axis)
-            -> Array<decltype(op(arr.data()[0], arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            using T_o = decltype(op(arr.data()[0], arr.data()[0]));
+            return transform(lhs, rhs, std::bit_and<>{});
+        }
 
-            if (empty(arr)) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator&(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::bit_and<>{});
+        }
 
-            const std::int64_t fixed_axis{ modulo(axis, std::ssize(arr.header().dims())) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator&(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::bit_and<>{});
+        }
 
-            typename Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), fixed_axis);
-            if (new_header.empty()) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator&(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::bit_and<>{});
+        }
 
-            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ new_header.count() });
-            res.header() = std::move(new_header);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator&=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::bit_and<>{});
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header(), std::ssize(arr.header().dims()) - fixed_axis - 1);
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator&=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, std::bit_and<>{});
+        }
 
-            const std::int64_t reduction_iteration_cycle{ arr.header().dims()[fixed_axis] };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator|(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::bit_or<>{});
+        }
 
-            while (arr_gen && res_gen) {
-                T_o res_element{ static_cast<T_o>(arr(*arr_gen)) };
-                ++arr_gen;
-                for (std::int64_t i = 0; i < reduction_iteration_cycle - 1; ++i, ++arr_gen) {
-                    res_element = op(res_element, arr(*arr_gen));
-                }
-                res(*res_gen) = res_element;
-                ++res_gen;
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator|(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::bit_or<>{});
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator|(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::bit_or<>{});
         }
 
-        template <typename T, typename T_o, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto reduce(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& init_values, Binary_op&& op, std::int64_t axis)
-            -> Array<decltype(op(init_values.data()[0], arr.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator|(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            if (empty(arr)) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(std::move(lhs), std::move(rhs), std::bit_or<>{});
+        }
 
-            const std::int64_t fixed_axis{ modulo(axis, std::ssize(arr.header().dims())) };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator|(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, std::bit_or<>{});
+        }
 
-            if (init_values.header().dims().size() != 1 && init_values.header().dims()[fixed_axis] != arr.header().dims()[fixed_axis]) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator|(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
+        {
+            return transform(std::move(lhs), rhs, std::bit_or<>{});
+        }
 
-            typename Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), axis);
-            if (new_header.empty()) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator|(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, std::bit_or<>{});
+        }
 
-            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ new_header.count() });
-            res.header() = std::move(new_header);
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator|(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), std::bit_or<>{});
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header(), std::ssize(arr.header().dims()) - fixed_axis - 1);
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> init_gen(init_values.header());
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator|=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, std::bit_or<>{});
+        }
 
-            const std::int64_t reduction_iteration_cycle{ arr.header().dims()[fixed_axis] };
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator|=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, std::bit_or<>{});
+        }
 
-            while (arr_gen && res_gen && init_gen) {
-                T_o res_element{ init_values(*init_gen) };
-                for (std::int64_t i = 0; i < reduction_iteration_cycle; ++i, ++arr_gen) {
-                    res_element = op(res_element, arr(*arr_gen));
-                }
-                res(*res_gen) = std::move(res_element);
-                ++res_gen;
-                ++init_gen;
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator<<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a << b; });
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator<<(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a << b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator<<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return reduce(arr, [](const T& a, const T& b) { return a && b; });
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a << b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> all(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t axis)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator<<(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return reduce(arr, [](const T& a, const T& b) { return a && b; }, axis);
+            return transform(std::move(lhs), std::move(rhs), [](const T1& a, const T2& b) { return a << b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool any(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator<<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            return reduce(arr, [](const T& a, const T& b) { return a || b; });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a << b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> any(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::int64_t axis)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator<<(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            return reduce(arr, [](const T& a, const T& b) { return a || b; }, axis);
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a << b; });
         }
 
-        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto transform(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
-            -> Array<decltype(op(lhs.data()[0], rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator<<(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+            -> Array<decltype(lhs << rhs.data()[0]), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
         {
-            using T_o = decltype(op(lhs.data()[0], rhs.data()[0]));
-            
-            if (!std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
-                return Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a << b; });
+        }
 
-            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(lhs.header().dims().data(), lhs.header().dims().size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator<<=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a << b; });
+        }
 
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(lhs.header()); gen; ++gen) {
-                res(*gen) = op(lhs(*gen), rhs(*gen));
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator<<=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a << b; });
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator>>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >> b; });
         }
 
-        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto transform(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, Binary_op&& op)
-            -> Array<decltype(op(lhs.data()[0], rhs)), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator>>(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            using T_o = decltype(op(lhs.data()[0], rhs));
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(lhs.header().dims().data(), lhs.header().dims().size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator>>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(lhs.header()); gen; ++gen) {
-                res(*gen) = op(lhs(*gen), rhs);
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator>>(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(std::move(lhs), std::move(rhs), [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator>>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        {
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >> b; });
         }
 
-        template <typename T1, typename T2, typename Binary_op, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto transform(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_op&& op)
-            -> Array<decltype(op(lhs, rhs.data()[0])), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator>>(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            using T_o = decltype(op(lhs, rhs.data()[0]));
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            Array<T_o, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res(std::span<const std::int64_t>(rhs.header().dims().data(), rhs.header().dims().size()));
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator>>(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(rhs.header()); gen; ++gen) {
-                res(*gen) = op(lhs, rhs(*gen));
-            }
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator>>(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
+        {
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            return res;
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator>>=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        {
+            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a >> b; });
         }
 
-        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator>>=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a >> b; });
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() });
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator~(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { return ~a; });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator~(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { return ~a; });
+        }
 
-            std::int64_t res_count{ 0 };
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator!(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { return !a; });
+        }
 
-            while (arr_gen && res_gen) {
-                if (pred(arr(*arr_gen))) {
-                    res(*res_gen) = arr(*arr_gen);
-                    ++res_count;
-                    ++res_gen;
-                }
-                ++arr_gen;
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator!(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { return !a; });
+        }
 
-            if (res_count == 0) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator+(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { return +a; });
+        }
 
-            if (res_count < arr.header().count()) {
-                return resize(res, { res_count });
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator+(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { return +a; });
+        }
 
-            return res;
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator-(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { return -a; });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> filter(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator-(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
         {
-            if (empty(arr)) {
-                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(std::move(arr), [](const T& a) { return -a; });
+        }
 
-            if (!std::equal(arr.header().dims().begin(), arr.header().dims().end(), mask.header().dims().begin(), mask.header().dims().end())) {
-                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto abs(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::abs; return abs(a); });
+        }
 
-            Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() });
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto abs(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::abs; return abs(a); });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> mask_gen(mask.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto acos(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::acos; return acos(a); });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto acos(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::acos; return acos(a); });
+        }
 
-            std::int64_t res_count{ 0 };
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto acosh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::acosh; return acosh(a); });
+        }
 
-            while (arr_gen && mask_gen && res_gen) {
-                if (mask(*mask_gen)) {
-                    res(*res_gen) = arr(*arr_gen);
-                    ++res_count;
-                    ++res_gen;
-                }
-                ++arr_gen;
-                ++mask_gen;
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto acosh(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::acosh; return acosh(a); });
+        }
 
-            if (res_count == 0) {
-                return Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto asin(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::asin; return asin(a); });
+        }
 
-            if (res_count < arr.header().count()) {
-                return resize(res, { res_count });
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto asin(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::asin; return asin(a); });
+        }
 
-            return res;
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto asinh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::asinh; return asinh(a); });
         }
 
-        template <typename T, typename Unary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, Unary_pred pred)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto asinh(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
         {
-            if (empty(arr)) {
-                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(std::move(arr), [](const T& a) { using std::asinh; return asinh(a); });
+        }
 
-            Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() });
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto atan(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::atan; return atan(a); });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto atan(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::atan; return atan(a); });
+        }
 
-            std::int64_t res_count{ 0 };
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto atanh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::atanh; return atanh(a); });
+        }
 
-            while (arr_gen && res_gen) {
-                if (pred(arr(*arr_gen))) {
-                    res(*res_gen) = *arr_gen;
-                    ++res_count;
-                    ++res_gen;
-                }
-                ++arr_gen;
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto atanh(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::atanh; return atanh(a); });
+        }
 
-            if (res_count == 0) {
-                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto cos(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::cos; return cos(a); });
+        }
 
-            if (res_count < arr.header().count()) {
-                return resize(res, { res_count });
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto cos(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::cos; return cos(a); });
+        }
 
-            return res;
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto cosh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::cosh; return cosh(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> find(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& mask)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto cosh(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
         {
-            if (empty(arr)) {
-                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(std::move(arr), [](const T& a) { using std::cosh; return cosh(a); });
+        }
 
-            if (!std::equal(arr.header().dims().begin(), arr.header().dims().end(), mask.header().dims().begin(), mask.header().dims().end())) {
-                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto exp(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::exp; return exp(a); });
+        }
 
-            Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() });
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto exp(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::exp; return exp(a); });
+        }
+        
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto log(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::log; return log(a); });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> mask_gen(mask.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto log(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::log; return log(a); });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto log10(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::log10; return log10(a); });
+        }
 
-            std::int64_t res_count{ 0 };
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto log10(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::log10; return log10(a); });
+        }
 
-            while (arr_gen && mask_gen && res_gen) {
-                if (mask(*mask_gen)) {
-                    res(*res_gen) = *arr_gen;
-                    ++res_count;
-                    ++res_gen;
-                }
-                ++arr_gen;
-                ++mask_gen;
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto pow(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { return pow(a); });
+        }
 
-            if (res_count == 0) {
-                return Array<std::int64_t, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto pow(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { return pow(a); });
+        }
 
-            if (res_count < arr.header().count()) {
-                return resize(res, { res_count });
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto sin(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::sin; return sin(a); });
+        }
 
-            return res;
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto sin(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::sin; return sin(a); });
         }
 
         template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> transpose(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::span<const std::int64_t> order)
+        [[nodiscard]] inline auto sinh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
         {
-            if (empty(arr)) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+            return transform(arr, [](const T& a) { using std::sinh; return sinh(a); });
+        }
 
-            typename Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>::Header new_header(arr.header(), order);
-            if (new_header.empty()) {
-                return Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>();
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto sinh(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::sinh; return sinh(a); });
+        }
 
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> res({ arr.header().count() });
-            res.header() = std::move(new_header);
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto sqrt(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::sqrt; return sqrt(a); });
+        }
 
-            Array_indices_generator<Dims_capacity, Internals_allocator> arr_gen(arr.header(), order);
-            Array_indices_generator<Dims_capacity, Internals_allocator> res_gen(res.header());
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto sqrt(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::sqrt; return sqrt(a); });
+        }
 
-            while (arr_gen && res_gen) {
-                res(*res_gen) = arr(*arr_gen);
-                ++arr_gen;
-                ++res_gen;
-            }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto tan(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            return transform(arr, [](const T& a) { using std::tan; return tan(a); });
+        }
 
-            return res;
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto tan(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return transform(std::move(arr), [](const T& a) { using std::tan; return tan(a); });
         }
 
         template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> transpose(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, std::initializer_list<std::int64_t> order)
+        [[nodiscard]] inline auto tanh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
         {
-            return transpose(arr, std::span<const std::int64_t>(order.begin(), order.size() ));
+            return transform(arr, [](const T& a) { using std::tanh; return tanh(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator==(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto tanh(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
+            return transform(std::move(arr), [](const T& a) { using std::tanh; return tanh(a); });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator==(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        [[nodiscard]] inline auto operator&&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator==(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline auto operator&&(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator!=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline auto operator&&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a != b; });
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator!=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        [[nodiscard]] inline auto operator&&(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a != b; });
+            return transform(std::move(lhs), std::move(rhs), [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator!=(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator&&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a != b; });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{})>(), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{})>())
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator&&(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            return transform(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator&&(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> close(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator&&(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return transform(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a && b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline auto operator||(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a > b; });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        [[nodiscard]] inline auto operator||(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a > b; });
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline auto operator||(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a > b; });
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline auto operator||(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >= b; });
+            return transform(std::move(lhs), std::move(rhs), [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator||(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >= b; });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator>=(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline auto operator||(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& lhs, const T2& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >= b; });
+            return transform(std::move(lhs), rhs, [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator||(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a < b; });
+            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a || b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline auto operator||(const T1& lhs, Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a < b; });
+            return transform(lhs, std::move(rhs), [](const T1& a, const T2& b) { return a || b; });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            if (empty(arr)) {
+                return arr;
+            }
+
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; ++gen) {
+                ++arr(*gen);
+            }
+            return arr;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return operator++(arr);
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, int)
+        {
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> old = clone(arr);
+            operator++(arr);
+            return old;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr, int)
+        {
+            return operator++(arr, int{});
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto& operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        {
+            if (empty(arr)) {
+                return arr;
+            }
+
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; ++gen) {
+                --arr(*gen);
+            }
+            return arr;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        {
+            return operator--(arr);
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        inline auto operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, int)
+        {
+            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> old = clone(arr);
+            operator--(arr);
+            return old;
+        }
+
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr, int)
+        {
+            return operator--(arr, int{});
+        }
+
+        template <typename T1, typename T2, typename Binary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline bool all_match(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_pred pred)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a < b; });
+            if (empty(lhs) && empty(rhs)) {
+                return true;
+            }
+
+            if (empty(lhs) || empty(rhs)) {
+                return false;
+            }
+
+            if (!std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
+                return false;
+            }
+
+            if (!lhs.header().is_subarray() && !rhs.header().is_subarray()) {
+                const T1* lhs_data_ptr{ lhs.data() };
+                const T2* rhs_data_ptr{ rhs.data() };
+                for (std::int64_t i = 0; i < lhs.header().count(); ++i) {
+                    if (!pred(lhs_data_ptr[i], rhs_data_ptr[i])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header());
+            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header());
+
+            for (; lhs_gen && rhs_gen; ++lhs_gen, ++rhs_gen) {
+                if (!pred(lhs(*lhs_gen), rhs(*rhs_gen))) {
+                    return false;
+                }
+            }
+
+            return true;
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a <= b; });
+        template <typename T1, typename T2, typename Binary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline bool all_match(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, Binary_pred pred)
+        {
+            if (empty(lhs)) {
+                return true;
+            }
+
+            if (!lhs.header().is_subarray()) {
+                const T1* lhs_data_ptr{ lhs.data() };
+                for (std::int64_t i = 0; i < lhs.header().count(); ++i) {
+                    if (!pred(lhs_data_ptr[i], rhs)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(lhs.header()); gen; ++gen) {
+                if (!pred(lhs(*gen), rhs)) {
+                    return false;
+                }
+            }
+
+            return true;
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<=(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <typename T1, typename T2, typename Binary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline bool all_match(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_pred pred)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a <= b; });
-        }
+            if (empty(rhs)) {
+                return true;
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline Array<bool, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> operator<=(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a <= b; });
-        }
+            if (!rhs.header().is_subarray()) {
+                const T2* rhs_data_ptr{ rhs.data() };
+                for (std::int64_t i = 0; i < rhs.header().count(); ++i) {
+                    if (!pred(lhs, rhs_data_ptr[i])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator+(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a + b; });
-        }
+            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(rhs.header()); gen; ++gen) {
+                if (!pred(lhs, rhs(*gen))) {
+                    return false;
+                }
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator+(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a + b; });
+            return true;
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator+(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline bool all_equal(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a + b; });
+            return all_match(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator+=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline bool all_equal(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
         {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a + b; });
+            return all_match(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator+=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline bool all_equal(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
         {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a + b; });
+            return all_match(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator-(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        [[nodiscard]] inline bool all_close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a - b; });
+            return all_match(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator-(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        requires (!Lazy_expression<T2>)
+        [[nodiscard]] inline bool all_close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a - b; });
+            return all_match(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
         }
 
         template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator-(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        requires (!Lazy_expression<T1>)
+        [[nodiscard]] inline bool all_close(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a - b; });
+            return all_match(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator-=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a - b; });
-        }
+        template <typename T>
+        struct Is_array : std::false_type {};
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator-=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a - b; });
-        }
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        struct Is_array<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>> : std::true_type {};
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator*(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a * b; });
-        }
+        template <typename Array_type, typename U>
+        struct Rebind_array {};
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator*(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a * b; });
-        }
+        template <typename T, typename U, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        struct Rebind_array<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>, U> {
+            using type = Array<U, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>;
+        };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator*(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a * b; });
-        }
+        /**
+        * @tparam Array_storage Either a const reference to a referenced array or an array type for an owned (moved) array.
+        */
+        template <typename Array_storage>
+        class Lazy_array final : public Lazy_expression_tag {
+        public:
+            using array_type = std::remove_cvref_t<Array_storage>;
+            using value_type = std::remove_cvref_t<decltype(*std::declval<array_type>().data())>;
+            template <typename U>
+            using array_of = typename Rebind_array<array_type, U>::type;
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator*=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a * b; });
-        }
+            static constexpr bool is_scalar{ false };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator*=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a * b; });
-        }
+            template <typename Array_type>
+            requires (Is_array<std::remove_cvref_t<Array_type>>::value)
+            explicit Lazy_array(Array_type&& arr)
+                : arr_(std::forward<Array_type>(arr))
+            {
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator/(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a / b; });
-        }
+            [[nodiscard]] std::span<const std::int64_t> dims() const noexcept
+            {
+                return arr_.header().dims();
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator/(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a / b; });
-        }
+            [[nodiscard]] bool is_valid() const noexcept
+            {
+                return true;
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator/(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a / b; });
-        }
+            /**
+            * @param index Position of the element in a dense array of the same dimensions.
+            */
+            [[nodiscard]] value_type operator[](std::int64_t index) const noexcept
+            {
+                if (!arr_.header().is_subarray()) {
+                    return arr_.data()[index];
+                }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator/=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a / b; });
-        }
+                return arr_.data()[pos2ind(arr_.header().offset(), arr_.header().strides(), arr_.header().dims(), index)];
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator/=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a / b; });
-        }
+        private:
+            Array_storage arr_;
+        };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto operator%(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a % b; });
-        }
+        template <typename T>
+        class Lazy_scalar final : public Lazy_expression_tag {
+        public:
+            using value_type = T;
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator%(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a % b; });
-        }
+            static constexpr bool is_scalar{ true };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator%(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a % b; });
-        }
+            explicit Lazy_scalar(const T& value)
+                : value_(value)
+            {
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator%=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a % b; });
-        }
+            [[nodiscard]] std::span<const std::int64_t> dims() const noexcept
+            {
+                return {};
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator%=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a % b; });
-        }
+            [[nodiscard]] bool is_valid() const noexcept
+            {
+                return true;
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator^(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a ^ b; });
-        }
+            [[nodiscard]] const T& operator[](std::int64_t) const noexcept
+            {
+                return value_;
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator^(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a ^ b; });
-        }
+        private:
+            T value_;
+        };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator^(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a ^ b; });
-        }
+        template <typename Unary_op, typename Expression>
+        class Lazy_unary_expression final : public Lazy_expression_tag {
+        public:
+            using value_type = decltype(std::declval<const Unary_op&>()(std::declval<const Expression&>()[0]));
+            template <typename U>
+            using array_of = typename Expression::template array_of<U>;
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator^=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a ^ b; });
-        }
+            static constexpr bool is_scalar{ false };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator^=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a ^ b; });
-        }
+            Lazy_unary_expression(Unary_op op, Expression expr)
+                : op_(std::move(op)), expr_(std::move(expr))
+            {
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a & b; });
-        }
+            [[nodiscard]] std::span<const std::int64_t> dims() const noexcept
+            {
+                return expr_.dims();
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a & b; });
-        }
+            [[nodiscard]] bool is_valid() const noexcept
+            {
+                return expr_.is_valid();
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator&(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a & b; });
-        }
+            [[nodiscard]] value_type operator[](std::int64_t index) const
+            {
+                return op_(expr_[index]);
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator&=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a & b; });
-        }
+        private:
+            Unary_op op_;
+            Expression expr_;
+        };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator&=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a & b; });
-        }
+        /**
+        * @note At least one of the operands is not a scalar. Operands of different dimensions result in an invalid expression, which evaluates to an empty array.
+        */
+        template <typename Binary_op, typename Lhs_expression, typename Rhs_expression>
+        class Lazy_binary_expression final : public Lazy_expression_tag {
+        public:
+            using value_type = decltype(std::declval<const Binary_op&>()(std::declval<const Lhs_expression&>()[0], std::declval<const Rhs_expression&>()[0]));
+            template <typename U>
+            using array_of = typename std::conditional_t<Lhs_expression::is_scalar, Rhs_expression, Lhs_expression>::template array_of<U>;
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator|(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a | b; });
-        }
+            static constexpr bool is_scalar{ false };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator|(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a | b; });
-        }
+            Lazy_binary_expression(Binary_op op, Lhs_expression lhs, Rhs_expression rhs)
+                : op_(std::move(op)), lhs_(std::move(lhs)), rhs_(std::move(rhs))
+            {
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator|(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a | b; });
-        }
+            [[nodiscard]] std::span<const std::int64_t> dims() const noexcept
+            {
+                if constexpr (Lhs_expression::is_scalar) {
+                    return rhs_.dims();
+                }
+                else {
+                    return lhs_.dims();
+                }
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator|=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a | b; });
-        }
+            [[nodiscard]] bool is_valid() const noexcept
+            {
+                if (!lhs_.is_valid() || !rhs_.is_valid()) {
+                    return false;
+                }
+                if constexpr (Lhs_expression::is_scalar || Rhs_expression::is_scalar) {
+                    return true;
+                }
+                else {
+                    return std::equal(lhs_.dims().begin(), lhs_.dims().end(), rhs_.dims().begin(), rhs_.dims().end());
+                }
+            }
+
+            [[nodiscard]] value_type operator[](std::int64_t index) const
+            {
+                return op_(lhs_[index], rhs_[index]);
+            }
+
+        private:
+            Binary_op op_;
+            Lhs_expression lhs_;
+            Rhs_expression rhs_;
+        };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator|=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto lazy(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
         {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a | b; });
+            return Lazy_array<const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&>(arr);
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator<<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
+        [[nodiscard]] inline auto lazy(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a << b; });
+            return Lazy_array<Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>>(std::move(arr));
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator<<(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <typename T>
+        requires (!Is_array<std::remove_cvref_t<T>>::value)
+        [[nodiscard]] inline auto lazy(T&& operand)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a << b; });
+            if constexpr (Lazy_expression<T>) {
+                return std::remove_cvref_t<T>(std::forward<T>(operand));
+            }
+            else {
+                return Lazy_scalar<std::remove_cvref_t<T>>(std::forward<T>(operand));
+            }
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator<<(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-            -> Array<decltype(lhs << rhs.data()[0]), Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>
+        template <typename Unary_op, Lazy_expression Expression>
+        [[nodiscard]] inline auto transform(Expression&& expr, Unary_op&& op)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a << b; });
+            return Lazy_unary_expression<std::remove_cvref_t<Unary_op>, std::remove_cvref_t<Expression>>(std::forward<Unary_op>(op), std::forward<Expression>(expr));
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator<<=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <typename Lhs, typename Rhs, typename Binary_op>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto transform(Lhs&& lhs, Rhs&& rhs, Binary_op&& op)
         {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a << b; });
+            auto lhs_expr{ lazy(std::forward<Lhs>(lhs)) };
+            auto rhs_expr{ lazy(std::forward<Rhs>(rhs)) };
+            return Lazy_binary_expression<std::remove_cvref_t<Binary_op>, decltype(lhs_expr), decltype(rhs_expr)>(std::forward<Binary_op>(op), std::move(lhs_expr), std::move(rhs_expr));
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator<<=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <Lazy_expression Expression, typename Binary_op>
+        [[nodiscard]] inline auto reduce(const Expression& expr, Binary_op&& op)
+            -> decltype(op(expr[0], expr[0]))
         {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a << b; });
-        }
+            using T_o = decltype(op(expr[0], expr[0]));
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator>>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >> b; });
-        }
+            const std::int64_t count{ expr.is_valid() ? numel(expr.dims()) : 0 };
+            if (count <= 0) {
+                return T_o{};
+            }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator>>(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
-        {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >> b; });
+            T_o res{ static_cast<T_o>(expr[0]) };
+            for (std::int64_t i = 1; i < count; ++i) {
+                res = op(res, expr[i]);
+            }
+            return res;
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator>>(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <Lazy_expression Expression, typename T_o, typename Binary_op>
+        [[nodiscard]] inline auto reduce(const Expression& expr, const T_o& init_value, Binary_op&& op)
+            -> decltype(op(init_value, expr[0]))
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a >> b; });
-        }
+            const std::int64_t count{ expr.is_valid() ? numel(expr.dims()) : 0 };
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator>>=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
-        {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a >> b; });
+            T_o res{ init_value };
+            for (std::int64_t i = 0; i < count; ++i) {
+                res = op(res, expr[i]);
+            }
+            return res;
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator>>=(Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <typename Lhs, typename Rhs, typename Binary_pred>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline bool all_match(const Lhs& lhs, const Rhs& rhs, Binary_pred pred)
         {
-            return lhs.transform(rhs, [](const T1& a, const T2& b) { return a >> b; });
-        }
+            auto lhs_expr{ lazy(lhs) };
+            auto rhs_expr{ lazy(rhs) };
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator~(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
-        {
-            return transform(arr, [](const T& a) { return ~a; });
-        }
+            if (!lhs_expr.is_valid() || !rhs_expr.is_valid()) {
+                return false;
+            }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator!(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
-        {
-            return transform(arr, [](const T& a) { return !a; });
-        }
+            const std::int64_t lhs_count{ numel(lhs_expr.dims()) };
+            const std::int64_t rhs_count{ numel(rhs_expr.dims()) };
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator+(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
-        {
-            return transform(arr, [](const T& a) { return +a; });
-        }
+            if constexpr (!decltype(lhs_expr)::is_scalar && !decltype(rhs_expr)::is_scalar) {
+                if (lhs_count == 0 && rhs_count == 0) {
+                    return true;
+                }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator-(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
-        {
-            return transform(arr, [](const T& a) { return -a; });
+                if (!std::equal(lhs_expr.dims().begin(), lhs_expr.dims().end(), rhs_expr.dims().begin(), rhs_expr.dims().end())) {
+                    return false;
+                }
+            }
+
+            const std::int64_t count{ decltype(lhs_expr)::is_scalar ? rhs_count : lhs_count };
+            for (std::int64_t i = 0; i < count; ++i) {
+                if (!pred(lhs_expr[i], rhs_expr[i])) {
+                    return false;
+                }
+            }
+
+            return true;
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto abs(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline bool all_equal(const Lhs& lhs, const Rhs& rhs)
         {
-            return transform(arr, [](const T& a) { return abs(a); });
+            return all_match(lhs, rhs, [](const auto& a, const auto& b) { return a == b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto acos(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs, typename T_tol = decltype(typename decltype(lazy(std::declval<const Lhs&>()))::value_type{} - typename decltype(lazy(std::declval<const Rhs&>()))::value_type{})>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline bool all_close(const Lhs& lhs, const Rhs& rhs, const T_tol& atol = default_atol<T_tol>(), const T_tol& rtol = default_rtol<T_tol>())
         {
-            return transform(arr, [](const T& a) { return acos(a); });
+            return all_match(lhs, rhs, [&atol, &rtol](const auto& a, const auto& b) { return close(a, b, atol, rtol); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto acosh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator+(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return acosh(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::plus<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto asin(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator-(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return asin(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::minus<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto asinh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator*(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return asinh(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::multiplies<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto atan(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator/(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return atan(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::divides<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto atanh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator%(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return atanh(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::modulus<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto cos(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator^(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return cos(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::bit_xor<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto cosh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator&(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return cosh(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::bit_and<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto exp(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator|(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return exp(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::bit_or<>{});
         }
-        
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto log(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator<<(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return log(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), [](const auto& a, const auto& b) { return a << b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto log10(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator>>(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return log10(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), [](const auto& a, const auto& b) { return a >> b; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto pow(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator==(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return pow(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::equal_to<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto sin(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator!=(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return sin(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::not_equal_to<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto sinh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator>(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return sinh(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::greater<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto sqrt(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator>=(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return sqrt(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::greater_equal<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto tan(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator<(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return tan(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::less<>{});
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto tanh(const Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator<=(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(arr, [](const T& a) { return tanh(a); });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::less_equal<>{});
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator&&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator&&(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a && b; });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::logical_and<>{});
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator&&(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <typename Lhs, typename Rhs>
+        requires (Lazy_expression<Lhs> || Lazy_expression<Rhs>)
+        [[nodiscard]] inline auto operator||(Lhs&& lhs, Rhs&& rhs)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a && b; });
+            return transform(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs), std::logical_or<>{});
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator&&(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto operator~(Expression&& expr)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a && b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { return ~a; });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator||(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto operator!(Expression&& expr)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a || b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { return !a; });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator||(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto operator+(Expression&& expr)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a || b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { return +a; });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator||(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto operator-(Expression&& expr)
         {
-            return transform(lhs, rhs, [](const T1& a, const T2& b) { return a || b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { return -a; });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto abs(Expression&& expr)
         {
-            if (empty(arr)) {
-                return arr;
-            }
-
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; ++gen) {
-                ++arr(*gen);
-            }
-            return arr;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::abs; return abs(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto acos(Expression&& expr)
         {
-            return operator++(arr);
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::acos; return acos(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, int)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto acosh(Expression&& expr)
         {
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> old = clone(arr);
-            operator++(arr);
-            return old;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::acosh; return acosh(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator++(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr, int)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto asin(Expression&& expr)
         {
-            return operator++(arr, int{});
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::asin; return asin(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto& operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto asinh(Expression&& expr)
         {
-            if (empty(arr)) {
-                return arr;
-            }
-
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(arr.header()); gen; ++gen) {
-                --arr(*gen);
-            }
-            return arr;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::asinh; return asinh(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto atan(Expression&& expr)
         {
-            return operator--(arr);
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::atan; return atan(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        inline auto operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& arr, int)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto atanh(Expression&& expr)
         {
-            Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator> old = clone(arr);
-            operator--(arr);
-            return old;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::atanh; return atanh(a); });
         }
 
-        template <typename T, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline auto operator--(Array<T, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>&& arr, int)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto cos(Expression&& expr)
         {
-            return operator--(arr, int{});
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::cos; return cos(a); });
         }
 
-        template <typename T1, typename T2, typename Binary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_match(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_pred pred)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto cosh(Expression&& expr)
         {
-            if (empty(lhs) && empty(rhs)) {
-                return true;
-            }
-
-            if (empty(lhs) || empty(rhs)) {
-                return false;
-            }
-
-            if (!std::equal(lhs.header().dims().begin(), lhs.header().dims().end(), rhs.header().dims().begin(), rhs.header().dims().end())) {
-                return false;
-            }
-
-            Array_indices_generator<Dims_capacity, Internals_allocator> lhs_gen(lhs.header());
-            Array_indices_generator<Dims_capacity, Internals_allocator> rhs_gen(rhs.header());
-
-            for (; lhs_gen && rhs_gen; ++lhs_gen, ++rhs_gen) {
-                if (!pred(lhs(*lhs_gen), rhs(*rhs_gen))) {
-                    return false;
-                }
-            }
-
-            return true;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::cosh; return cosh(a); });
         }
 
-        template <typename T1, typename T2, typename Binary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_match(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, Binary_pred pred)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto exp(Expression&& expr)
         {
-            if (empty(lhs)) {
-                return true;
-            }
-
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(lhs.header()); gen; ++gen) {
-                if (!pred(lhs(*gen), rhs)) {
-                    return false;
-                }
-            }
-
-            return true;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::exp; return exp(a); });
         }
 
-        template <typename T1, typename T2, typename Binary_pred, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_match(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, Binary_pred pred)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto log(Expression&& expr)
         {
-            if (empty(rhs)) {
-                return true;
-            }
-
-            for (Array_indices_generator<Dims_capacity, Internals_allocator> gen(rhs.header()); gen; ++gen) {
-                if (!pred(lhs, rhs(*gen))) {
-                    return false;
-                }
-            }
-
-            return true;
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::log; return log(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_equal(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto log10(Expression&& expr)
         {
-            return all_match(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::log10; return log10(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_equal(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto sin(Expression&& expr)
         {
-            return all_match(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::sin; return sin(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_equal(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs)
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto sinh(Expression&& expr)
         {
-            return all_match(lhs, rhs, [](const T1& a, const T2& b) { return a == b; });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::sinh; return sinh(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto sqrt(Expression&& expr)
         {
-            return all_match(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::sqrt; return sqrt(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_close(const Array<T1, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& lhs, const T2& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto tan(Expression&& expr)
         {
-            return all_match(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::tan; return tan(a); });
         }
 
-        template <typename T1, typename T2, std::int64_t Data_capacity, std::int64_t Dims_capacity, template<typename> typename Data_allocator, template<typename> typename Internals_allocator>
-        [[nodiscard]] inline bool all_close(const T1& lhs, const Array<T2, Data_capacity, Dims_capacity, Data_allocator, Internals_allocator>& rhs, const decltype(T1{} - T2{})& atol = default_atol<decltype(T1{} - T2{}) > (), const decltype(T1{} - T2{})& rtol = default_rtol<decltype(T1{} - T2{}) > ())
+        template <Lazy_expression Expression>
+        [[nodiscard]] inline auto tanh(Expression&& expr)
         {
-            return all_match(lhs, rhs, [&atol, &rtol](const T1& a, const T2& b) { return close(a, b, atol, rtol); });
+            return transform(std::forward<Expression>(expr), [](const auto& a) { using std::tanh; return tanh(a); });
         }
     }
 
+    using details::dynamic_sequence;
     using details::Array;
+    using details::Fixed_rank_array;
+
+    using details::Arena_scope;
+    using details::Arena_allocator;
+
+    using details::Thread_pool;
+    using details::Parallel_execution_policy;
+    using details::par;
 
     using details::copy;
     using details::clone;
+    using details::copy_on_write;
+    using details::uninitialized;
     using details::reshape;
+    using details::reshape_copies;
     using details::resize;
     using details::append;
+    using details::concatenate;
+    using details::stack;
     using details::insert;
     using details::remove;
 
@@ -4421,11 +9988,28 @@ namespace computoc {
     using details::any;
     using details::filter;
     using details::find;
+    using details::Bit_mask;
+    using details::pack;
+    using details::unpack;
     using details::transpose;
     using details::close;
     using details::all_equal;
     using details::all_close;
 
+    using details::Map_mode;
+    using details::Access_advice;
+#if defined(__unix__)
+    using details::map_file;
+    using details::advise;
+#endif
+
+    using details::save;
+    using details::load;
+    using details::Npy_writer;
+    using details::Npy_reader;
+
+    using details::lazy;
+
 
     using details::abs;
     using details::acos;
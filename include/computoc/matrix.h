@@ -74,12 +74,14 @@ namespace computoc {
         }
 
         
-        // Every matrix with size less or equal to 9 will be allocated on stack
-        using Matrix_allocator = memoc::Malloc_allocator;
+        // Every matrix data is aligned to a cache line, and every matrix with size less or equal to 9 will be allocated on stack
+        inline constexpr std::int64_t matrix_alignment = 64;
+
+        using Matrix_allocator = memoc::Aligned_malloc_allocator<matrix_alignment>;
 
         template <typename T>
         using Matrix_buffer = memoc::Buffer<T, memoc::Fallback_allocator<
-            memoc::Stack_allocator<>,
+            memoc::Stack_allocator<memoc::details::Default_global_stack_memory<16, 2 * matrix_alignment, matrix_alignment>, matrix_alignment>,
             Matrix_allocator>>;
 
         template <typename T, typename Internal_buffer = Matrix_buffer<T>, memoc::Allocator Internal_allocator = Matrix_allocator>
@@ -424,6 +426,7 @@ namespace computoc {
     using details::is_inside;
     using details::to_buff_index;
 
+    using details::matrix_alignment;
     using details::Matrix;
     using details::clone;
     using details::copy;
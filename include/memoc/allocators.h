@@ -41,6 +41,14 @@ namespace memoc {
             {t.owns(std::cref(b))} noexcept -> std::same_as<bool>;
         };
 
+        template <class T, Block<void>::Size_type Alignment>
+        concept Aligned_allocator =
+            Allocator<T> &&
+            requires
+        {
+            {T::alignment} -> std::convertible_to<Block<void>::Size_type>;
+        }&& (T::alignment % Alignment == 0);
+
         template <Allocator Primary, Allocator Fallback>
         class Fallback_allocator final {
         public:
@@ -85,6 +93,8 @@ namespace memoc {
 
         class Malloc_allocator final {
         public:
+            static constexpr Block<void>::Size_type alignment = alignof(std::max_align_t);
+
             [[nodiscard]] constexpr erroc::Expected<Block<void>, Allocator_error> allocate(Block<void>::Size_type s) noexcept
             {
                 if (s < 0) {
@@ -115,6 +125,52 @@ namespace memoc {
             constexpr static std::int64_t uuid_ = encode_string("095deb2c-f51a-4193-b177-d6d686087c72");
         };
 
+        template <Block<void>::Size_type Alignment = 64>
+        class Aligned_malloc_allocator final {
+            static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
+        public:
+            static constexpr Block<void>::Size_type alignment = Alignment;
+
+            [[nodiscard]] erroc::Expected<Block<void>, Allocator_error> allocate(Block<void>::Size_type s) noexcept
+            {
+                if (s < 0) {
+                    return erroc::Unexpected(Allocator_error::invalid_size);
+                }
+                if (s == 0) {
+                    return Block<void>();
+                }
+                // aligned_alloc requires the size to be a multiple of the alignment
+                const Block<void>::Size_type as = ((s + Alignment - 1) / Alignment) * Alignment;
+#if defined(_MSC_VER)
+                Block<void> b(s, _aligned_malloc(as, Alignment), uuid_);
+#else
+                Block<void> b(s, std::aligned_alloc(Alignment, as), uuid_);
+#endif
+                if (b.empty()) {
+                    return erroc::Unexpected(Allocator_error::unknown);
+                }
+                return b;
+            }
+
+            void deallocate(Block<void>& b) noexcept
+            {
+#if defined(_MSC_VER)
+                _aligned_free(b.data());
+#else
+                std::free(b.data());
+#endif
+                b = Block<void>();
+            }
+
+            [[nodiscard]] constexpr bool owns(const Block<void>& b) const noexcept
+            {
+                return b.data() && b.hint() == uuid_;
+            }
+
+        private:
+            constexpr static std::int64_t uuid_ = encode_string("a1d5f0e6-3c55-4b8e-9f0a-64c1e7b2d9a4");
+        };
+
         template <class T>
         concept Stack_memory =
             requires
@@ -133,10 +189,11 @@ namespace memoc {
             {t.stack_owns(p)} noexcept -> std::same_as<bool>;
         };
 
-        template <std::int64_t Stacks_count, Block<void>::Size_type Buffer_size>
+        template <std::int64_t Stacks_count, Block<void>::Size_type Buffer_size, Block<void>::Size_type Alignment = 2>
         class Default_global_stack_memory final {
             static_assert(Stacks_count > 0);
             static_assert(Buffer_size > 1 && Buffer_size % 2 == 0);
+            static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0 && Buffer_size % Alignment == 0);
         public:
             constexpr Default_global_stack_memory() noexcept {
                 if (!initialized_) {
@@ -181,15 +238,21 @@ namespace memoc {
             }
 
         private:
-            inline static std::uint8_t buffers_[Stacks_count][Buffer_size];
+            alignas(Alignment) inline static std::uint8_t buffers_[Stacks_count][Buffer_size];
             inline static std::uint8_t* ptrs_[Stacks_count];
 
             inline static bool initialized_{ false };
         };
 
-        template <Stack_memory Internal_stack_memory = Default_global_stack_memory<16, 128>>
+        /**
+        * @note Blocks are aligned to Alignment only if the buffers of the stack memory are aligned to it as well.
+        */
+        template <Stack_memory Internal_stack_memory = Default_global_stack_memory<16, 128>, Block<void>::Size_type Alignment = 2>
         class Stack_allocator final {
+            static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
         public:
+            static constexpr Block<void>::Size_type alignment = Alignment;
+
             [[nodiscard]] constexpr erroc::Expected<Block<void>, Allocator_error> allocate(Block<void>::Size_type s) noexcept
             {
                 if (s < 0) {
@@ -219,7 +282,7 @@ namespace memoc {
         private:
             static constexpr Block<void>::Size_type align(Block<void>::Size_type s)
             {
-                return s % 2 == 0 ? s : s + 1;
+                return (s + Alignment - 1) & ~(Alignment - 1);
             }
 
             Internal_stack_memory sm_{};
@@ -567,6 +630,8 @@ namespace memoc {
     }
 
     using details::Allocator;
+    using details::Aligned_allocator;
+    using details::Aligned_malloc_allocator;
     using details::Fallback_allocator;
     using details::Free_list_allocator;
     using details::Malloc_allocator;
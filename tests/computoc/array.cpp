@@ -3,6 +3,8 @@
 #include <cstdint>
 
 #include <array>
+#include <numeric>
+#include <vector>
 #include <stdexcept>
 #include <regex>
 #include <string>
@@ -10,6 +12,8 @@
 #include <ranges>
 #include <ostream>
 #include <charconv>
+#include <fstream>
+#include <filesystem>
 
 #include <computoc/array.h>
 
@@ -501,6 +505,93 @@ TEST(Array_test, iterators)
     EXPECT_TRUE(std::equal(inds[3].begin(), inds[3].end(), res.begin()));
 }
 
+TEST(Array_test, random_access_iterators)
+{
+    using namespace computoc;
+
+    static_assert(std::random_access_iterator<decltype(std::declval<Array<int>&>().begin())>);
+    static_assert(std::random_access_iterator<decltype(std::declval<const Array<int>&>().cbegin())>);
+    static_assert(std::random_access_iterator<decltype(std::declval<Array<int>&>().rbegin())>);
+    static_assert(std::random_access_iterator<decltype(std::declval<const Array<int>&>().crbegin())>);
+
+    Array<int> arr{ {3, 4}, {
+        7, 3, 11, 1,
+        5, 12, 2, 9,
+        4, 10, 6, 8} };
+
+    {
+        const Array<int> carr{ clone(arr) };
+        EXPECT_EQ(12, carr.cend() - carr.cbegin());
+        EXPECT_EQ(12, carr.crend() - carr.crbegin());
+        EXPECT_EQ(2, carr.cbegin()[6]);
+        EXPECT_EQ(2, *(carr.cbegin() + 6));
+        EXPECT_EQ(2, *(6 + carr.cbegin()));
+        EXPECT_EQ(2, *(carr.cend() - 6));
+        EXPECT_EQ(2, carr.crbegin()[5]);
+        EXPECT_EQ(12, carr.cbegin(1)[4]);
+        EXPECT_EQ(12, *(carr.cend(1) - 8));
+        EXPECT_TRUE(carr.cbegin() < carr.cbegin() + 1);
+        EXPECT_TRUE(carr.crbegin() < carr.crbegin() + 1);
+
+        auto it{ carr.cbegin(1) + 11 };
+        EXPECT_EQ(8, *it);
+        EXPECT_EQ(9, *--it);
+        EXPECT_EQ(6, *(it -= 2));
+        EXPECT_EQ(3, *(it - 5));
+    }
+
+    // sorting a strided view sorts the viewed elements in place
+    {
+        Array<int> columns{ arr({ {0, 2}, {1, 3, 2} }) };
+        std::sort(columns.begin(), columns.end());
+        EXPECT_TRUE(all_equal(Array<int>({ 3, 4 }, {
+            7, 1, 11, 3,
+            5, 8, 2, 9,
+            4, 10, 6, 12 }), arr));
+
+        std::sort(arr.begin(1), arr.end(1));
+        EXPECT_TRUE(all_equal(Array<int>({ 3, 4 }, {
+            1, 4, 7, 10,
+            2, 5, 8, 11,
+            3, 6, 9, 12 }), arr));
+    }
+
+    {
+        std::sort(arr.rbegin(), arr.rend());
+        EXPECT_TRUE(std::is_sorted(arr.crbegin(), arr.crend()));
+        EXPECT_EQ(12, arr({ 0, 0 }));
+
+        std::nth_element(arr.begin(), arr.begin() + 5, arr.end());
+        EXPECT_EQ(6, arr.cbegin()[5]);
+
+        std::sort(arr.begin(), arr.end());
+        EXPECT_EQ(7, *std::lower_bound(arr.cbegin(), arr.cend(), 7));
+        EXPECT_EQ(6, std::lower_bound(arr.cbegin(), arr.cend(), 7) - arr.cbegin());
+    }
+}
+
+TEST(Simple_small_vector_test, assignment_returns_the_assigned_vector)
+{
+    using simple_vector = computoc::details::simple_small_vector<std::int64_t, 2>;
+
+    std::array<std::int64_t, 4> arr{ 1, 2, 3, 4 };
+
+    simple_vector sv1(4, arr.data());
+    simple_vector sv2;
+    simple_vector sv3;
+
+    (sv3 = sv2 = sv1)[0] = 5;
+    EXPECT_EQ(1, sv1[0]);
+    EXPECT_EQ(1, sv2[0]);
+    EXPECT_EQ(5, sv3[0]);
+
+    simple_vector& moved{ sv2 = std::move(sv3) };
+    EXPECT_EQ(&sv2, &moved);
+    EXPECT_EQ(4, sv2.size());
+    EXPECT_EQ(5, sv2[0]);
+    EXPECT_EQ(4, sv2[3]);
+}
+
 TEST(Simple_array_indices_generator, simple_forward_backward_iterations)
 {
     using namespace computoc::details;
@@ -660,6 +751,62 @@ TEST(Simple_array_indices_generator, forward_backward_iterations_by_specific_maj
     }
 }
 
+TEST(Simple_array_indices_generator, runs_of_merged_contiguous_dimensions)
+{
+    using namespace computoc::details;
+
+    const std::int64_t dims[]{ 2, 3, 4 }; // strides = {12, 4, 1}
+    Array_header hdr(std::span(dims, 3));
+
+    {
+        const Interval<std::int64_t> intervals[]{ {0, 1}, {0, 2}, {1, 2} }; // dims = {2, 3, 2}, merged to {6, 2}
+        Array_header shdr(hdr, std::span(intervals, 3));
+
+        const std::int64_t expected_run_starts[6]{ 1, 5, 9, 13, 17, 21 };
+        std::int64_t runs_counter{ 0 };
+
+        for (Simple_array_indices_generator gen(shdr); gen; gen.next_run()) {
+            EXPECT_EQ(expected_run_starts[runs_counter], *gen);
+            EXPECT_EQ(2, gen.run_length());
+            EXPECT_EQ(1, gen.run_stride());
+            ++runs_counter;
+        }
+        EXPECT_EQ(6, runs_counter);
+
+        Simple_array_indices_generator gen(shdr);
+        ++gen;
+        EXPECT_EQ(1, gen.run_length());
+        EXPECT_EQ(5, *gen.next_run());
+    }
+
+    {
+        const Interval<std::int64_t> intervals[]{ {1, 1}, {0, 2}, {0, 3} }; // dims = {1, 3, 4}, merged to {12}
+        Array_header shdr(hdr, std::span(intervals, 3));
+
+        Simple_array_indices_generator gen(shdr);
+        EXPECT_EQ(12, *gen);
+        EXPECT_EQ(12, gen.run_length());
+        EXPECT_EQ(1, gen.run_stride());
+        EXPECT_FALSE(gen.next_run());
+    }
+
+    {
+        const Interval<std::int64_t> intervals[]{ {0, 1}, {0, 2, 2}, {0, 3, 2} }; // dims = {2, 2, 2}, strides = {12, 8, 2}
+        Array_header shdr(hdr, std::span(intervals, 3));
+
+        const std::int64_t expected_run_starts[4]{ 0, 8, 12, 20 };
+        std::int64_t runs_counter{ 0 };
+
+        for (Array_indices_generator gen(shdr); gen; gen.next_run()) {
+            EXPECT_EQ(expected_run_starts[runs_counter], *gen);
+            EXPECT_EQ(2, gen.run_length());
+            EXPECT_EQ(2, gen.run_stride());
+            ++runs_counter;
+        }
+        EXPECT_EQ(4, runs_counter);
+    }
+}
+
 
 
 
@@ -795,6 +942,28 @@ TEST(Fast_array_indices_generator, forward_backward_iterations_by_specific_major
 
 
 
+TEST(Fast_array_indices_generator, stepping_over_size_one_axis_keeps_row_major_strides)
+{
+    using namespace computoc::details;
+
+    computoc::Array<int> arr({ 3, 1 });
+    auto sarr = arr({ {0, 2, 1}, {0, 0, 2} });
+    EXPECT_FALSE(sarr.header().is_subarray());
+    EXPECT_EQ(1, sarr.header().strides()[0]);
+    EXPECT_EQ(1, sarr.header().strides()[1]);
+
+    const std::int64_t expected_inds[]{ 0, 1, 2 };
+    std::int64_t generated_subs_counter{ 0 };
+
+    for (Array_indices_generator gen(sarr.header(), std::int64_t{ 0 }); gen; ++gen) {
+        EXPECT_EQ(expected_inds[generated_subs_counter], *gen);
+        ++generated_subs_counter;
+    }
+    EXPECT_EQ(3, generated_subs_counter);
+}
+
+
+
 TEST(Array_test, can_be_initialized_with_valid_size_and_data)
 {
     using Integer_array = computoc::Array<int>;
@@ -1022,6 +1191,25 @@ TEST(Array_test, have_read_write_access_to_slice)
     }
 
     //std::transform(sarr.cbegin(), sarr.cend(), sarr.begin(), [](auto a) { return a * 100; });
+
+    // slicing a subarray by fewer intervals than dimensions keeps the strides of the other axes
+    {
+        Integer_array ssarr{ arr({ {0, 1}, {0, 1}, {0, 2}, {0, 2, 2} })({ {1, 1}, {0, 1} }) };
+
+        const int rsdata[] = {
+            19, 21,
+            22, 24,
+            25, 27,
+
+            28, 30,
+            31, 33,
+            34, 36 };
+        EXPECT_TRUE(computoc::all_equal(Integer_array({ 1, 2, 3, 2 }, rsdata), ssarr));
+
+        ssarr = 0;
+        EXPECT_EQ(20, arr({ 1, 0, 0, 1 }));
+        EXPECT_EQ(0, arr({ 1, 1, 2, 2 }));
+    }
 }
 
 TEST(Array_test, element_wise_transformation)
@@ -1041,6 +1229,16 @@ TEST(Array_test, element_wise_transformation)
     computoc::Array oarr{ {dims, 3}, odata };
 
     EXPECT_TRUE(computoc::all_equal(oarr, computoc::transform(iarr, [](int n) {return n * 0.5; })));
+
+    // subarray transformation
+    {
+        const double sdata[]{
+            1.5, 2.0,
+            2.5, 3.0 };
+        computoc::Array sarr{ {2, 1, 2}, sdata };
+
+        EXPECT_TRUE(computoc::all_equal(sarr, computoc::transform(iarr({ {1, 2} }), [](int n) {return n * 0.5; })));
+    }
 }
 
 TEST(Array_test, element_wise_transform_operation)
@@ -1082,6 +1280,266 @@ TEST(Array_test, element_wise_transform_operation)
     EXPECT_TRUE(computoc::all_equal(oarr3, computoc::transform(1, iarr1, [](int a, int b) { return a - b; })));
 }
 
+TEST(Array_test, element_wise_operations_on_dense_arrays_with_any_number_of_elements)
+{
+    auto test_type = []<typename T>(T) {
+        for (std::int64_t count : { 1, 2, 7, 16, 33 }) {
+            computoc::Array<T> arr1{ { count } };
+            computoc::Array<T> arr2{ { count } };
+            for (std::int64_t i = 0; i < count; ++i) {
+                arr1({ i }) = static_cast<T>(i * 3 - 20);
+                arr2({ i }) = static_cast<T>(i % 5 + 1);
+            }
+
+            EXPECT_TRUE(computoc::all_equal(computoc::transform(arr1, arr2, [](T a, T b) { return a + b; }), arr1 + arr2));
+            EXPECT_TRUE(computoc::all_equal(computoc::transform(arr1, arr2, [](T a, T b) { return a * b; }), arr1 * arr2));
+            EXPECT_TRUE(computoc::all_equal(computoc::transform(arr1, arr2, [](T a, T b) { return a / b; }), arr1 / arr2));
+            EXPECT_TRUE(computoc::all_equal(computoc::transform(arr1, arr2, [](T a, T b) { return a >= b; }), arr1 >= arr2));
+            EXPECT_TRUE(computoc::all_equal(computoc::transform(arr1, T{ 2 }, [](T a, T b) { return a - b; }), arr1 - T{ 2 }));
+            EXPECT_TRUE(computoc::all_equal(computoc::transform(T{ 2 }, arr1, [](T a, T b) { return a < b; }), T{ 2 } < arr1));
+            if constexpr (std::is_integral_v<T>) {
+                EXPECT_TRUE(computoc::all_equal(computoc::transform(arr1, arr2, [](T a, T b) { return a ^ b; }), arr1 ^ arr2));
+            }
+
+            computoc::Array<T> rarr{ computoc::transform(arr1, arr2, [](T a, T b) { return a - b; }) };
+            arr1 -= arr2;
+            EXPECT_TRUE(computoc::all_equal(rarr, arr1));
+        }
+    };
+
+    test_type(float{});
+    test_type(double{});
+    test_type(std::int32_t{});
+    test_type(std::int64_t{});
+}
+
+TEST(Array_test, lazy_expressions_are_evaluated_on_assignment)
+{
+    const double data1[]{
+        1.0, 2.0, 3.0,
+        4.0, 5.0, 6.0 };
+    computoc::Array arr1{ {2, 3}, data1 };
+    computoc::Array arr2{ {2, 3}, 2.0 };
+
+    const double rdata1[]{
+        0.5, 2.5, 4.5,
+        6.5, 8.5, 10.5 };
+    computoc::Array rarr1{ {2, 3}, rdata1 };
+
+    computoc::Array<double> res{ computoc::lazy(arr1) * arr2 + 0.5 - 2.0 };
+    EXPECT_TRUE(computoc::all_equal(rarr1, res));
+
+    res = computoc::sqrt(computoc::lazy(arr1) * arr1) - computoc::abs(-computoc::lazy(arr2));
+    EXPECT_TRUE(computoc::all_close(arr1 - 2.0, res));
+
+    EXPECT_EQ(42.0, computoc::reduce(computoc::lazy(arr1) * 2.0, [](double a, double b) { return a + b; }));
+    EXPECT_EQ(43.0, computoc::reduce(computoc::lazy(arr1) * 2.0, 1.0, [](double a, double b) { return a + b; }));
+    EXPECT_TRUE(computoc::all_close(computoc::lazy(arr1) + arr1, arr1 * 2.0));
+    EXPECT_TRUE(computoc::all_equal(computoc::lazy(arr1) > 3.0, arr1 > 3.0));
+
+    // subarray
+    {
+        const double rdata2[]{
+            102.0, 103.0,
+            105.0, 106.0 };
+        computoc::Array rarr2{ {2, 2}, rdata2 };
+
+        EXPECT_TRUE(computoc::all_equal(rarr2, computoc::Array<double>(computoc::lazy(arr1({ {0, 1}, {1, 2} })) + 100.0)));
+    }
+
+    // named nodes
+    {
+        auto node{ computoc::lazy(arr1) };
+        const auto cnode{ computoc::lazy(arr2) };
+        EXPECT_TRUE(computoc::all_equal(rarr1, computoc::Array<double>(node * cnode + 0.5 - 2.0)));
+        EXPECT_TRUE(computoc::all_close(arr1 * 2.0, computoc::Array<double>(node + node)));
+    }
+
+    // aliasing of the assigned array and the operands
+    {
+        const int data[] = { 1, 2, 3, 4 };
+        computoc::Array<int> arr{ {4}, data };
+
+        auto a = arr({ {0, 2} });
+        auto c = arr({ {1, 3} });
+        c = computoc::lazy(a);
+        const int rdata[] = { 1, 2, 3 };
+        EXPECT_TRUE(computoc::all_equal(c, computoc::Array<int>{ {3}, rdata }));
+        EXPECT_TRUE(computoc::all_equal(arr, computoc::Array<int>{ {4}, data }));
+
+        arr({ {1, 3} }) = computoc::lazy(arr({ {0, 2} }));
+        const int rarrdata[] = { 1, 1, 2, 3 };
+        EXPECT_TRUE(computoc::all_equal(arr, computoc::Array<int>{ {4}, rarrdata }));
+
+        // a buffer not shared by other arrays is written in place
+        computoc::Array<int> uarr{ {4}, data };
+        const int* udata{ std::as_const(uarr).data() };
+        uarr = computoc::lazy(uarr) * 2;
+        EXPECT_EQ(udata, std::as_const(uarr).data());
+        const int ruarrdata[] = { 2, 4, 6, 8 };
+        EXPECT_TRUE(computoc::all_equal(uarr, computoc::Array<int>{ {4}, ruarrdata }));
+
+        computoc::Array<int> shared{ uarr };
+        uarr = computoc::lazy(uarr) + 1;
+        EXPECT_NE(udata, std::as_const(uarr).data());
+        EXPECT_TRUE(computoc::all_equal(shared, computoc::Array<int>{ {4}, ruarrdata }));
+    }
+
+    // different dimensions
+    {
+        EXPECT_TRUE(computoc::empty(computoc::Array<double>(computoc::lazy(arr1) + computoc::Array<double>({ 6 }, 1.0))));
+        EXPECT_FALSE(computoc::all_equal(computoc::lazy(arr1), computoc::Array<double>({ 6 }, 1.0)));
+    }
+}
+
+TEST(Array_test, parallel_execution_of_element_wise_algorithms)
+{
+    computoc::Thread_pool pool{ 4 };
+    computoc::Parallel_execution_policy policy{ &pool, 4 };
+
+    computoc::Array<int> arr{ { 9, 7 } };
+    for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+        arr.data()[i] = static_cast<int>(i);
+    }
+    computoc::Array<int> sarr{ arr({ {1, 8, 2}, {0, 6, 3} }) };
+
+    for (const computoc::Array<int>& a : { arr, sarr }) {
+        EXPECT_TRUE(computoc::all_equal(computoc::transform(a, [](int n) { return n * 0.5; }), computoc::transform(policy, a, [](int n) { return n * 0.5; })));
+        EXPECT_TRUE(computoc::all_equal(a + a, computoc::transform(policy, a, a, std::plus<>{})));
+        EXPECT_TRUE(computoc::all_equal(a - 1, computoc::transform(policy, a, 1, std::minus<>{})));
+        EXPECT_TRUE(computoc::all_equal(1 - a, computoc::transform(policy, 1, a, std::minus<>{})));
+
+        EXPECT_EQ(computoc::reduce(a, std::plus<>{}), computoc::reduce(policy, a, std::plus<>{}));
+        EXPECT_EQ(computoc::reduce(a, 5, std::plus<>{}), computoc::reduce(policy, a, 5, std::plus<>{}));
+
+        EXPECT_TRUE(computoc::all_equal(computoc::filter(a, [](int n) { return n % 3 == 0; }), computoc::filter(policy, a, [](int n) { return n % 3 == 0; })));
+        EXPECT_TRUE(computoc::all_equal(computoc::find(a, [](int n) { return n % 3 == 0; }), computoc::find(policy, a, [](int n) { return n % 3 == 0; })));
+    }
+
+    EXPECT_EQ(computoc::reduce(arr, std::plus<>{}), computoc::reduce(computoc::par, arr, std::plus<>{}));
+
+    EXPECT_THROW((void)computoc::transform(policy, arr, [](int n) { return n < 60 ? n : throw std::runtime_error("invalid element"); }), std::runtime_error);
+}
+
+TEST(Array_test, stream_compaction_by_chunks)
+{
+    computoc::Thread_pool pool{ 4 };
+    computoc::Parallel_execution_policy policy{ &pool, 100 };
+
+    const std::int64_t count{ 1000 };
+
+    auto check = [&]<typename T>(T) {
+        computoc::Array<T> arr{ { count } };
+        for (std::int64_t i = 0; i < count; ++i) {
+            arr.data()[i] = static_cast<T>(i % 127);
+        }
+
+        for (int divisor : { 1, 2, 61, 200 }) {
+            auto pred = [divisor](T n) { return static_cast<int>(n) % divisor == 0; };
+
+            std::vector<T> rvalues;
+            std::vector<std::int64_t> rindices;
+            for (std::int64_t i = 0; i < count; ++i) {
+                if (pred(arr.data()[i])) {
+                    rvalues.push_back(arr.data()[i]);
+                    rindices.push_back(i);
+                }
+            }
+
+            const computoc::Array<T> rarr{ { std::ssize(rvalues) }, std::as_const(rvalues).data() };
+            const computoc::Array<std::int64_t> rinds{ { std::ssize(rindices) }, std::as_const(rindices).data() };
+
+            EXPECT_TRUE(computoc::all_equal(rarr, computoc::filter(arr, pred)));
+            EXPECT_TRUE(computoc::all_equal(rarr, computoc::filter(policy, arr, pred)));
+            EXPECT_TRUE(computoc::all_equal(rinds, computoc::find(arr, pred)));
+            EXPECT_TRUE(computoc::all_equal(rinds, computoc::find(policy, arr, pred)));
+        }
+
+        EXPECT_TRUE(computoc::empty(computoc::filter(policy, arr, [](T) { return false; })));
+        EXPECT_TRUE(computoc::empty(computoc::find(policy, arr, [](T) { return false; })));
+    };
+
+    check(int{});
+    check(double{});
+    check(std::int64_t{});
+    check(std::int16_t{});
+
+    // indices of a subarray refer to its buffer
+    computoc::Array<int> arr{ { 100, 10 } };
+    for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+        arr.data()[i] = static_cast<int>(i);
+    }
+    computoc::Array<int> sarr{ arr({ {0, 99, 2}, {1, 9, 4} }) };
+    auto pred = [](int n) { return n % 3 == 0; };
+
+    std::vector<int> rvalues;
+    for (std::int64_t i = 0; i < 100; i += 2) {
+        for (std::int64_t j = 1; j < 10; j += 4) {
+            if (pred(static_cast<int>(i * 10 + j))) {
+                rvalues.push_back(static_cast<int>(i * 10 + j));
+            }
+        }
+    }
+    const computoc::Array<int> rarr{ { std::ssize(rvalues) }, std::as_const(rvalues).data() };
+    EXPECT_TRUE(computoc::all_equal(rarr, computoc::filter(policy, sarr, pred)));
+    EXPECT_TRUE(computoc::all_equal(rarr, computoc::find(policy, sarr, pred)));
+    EXPECT_TRUE(computoc::all_equal(rarr, computoc::filter(sarr, computoc::transform(sarr, pred))));
+    EXPECT_TRUE(computoc::all_equal(rarr, computoc::find(sarr, computoc::transform(sarr, pred))));
+}
+
+TEST(Array_test, broadcasting_of_element_wise_operations)
+{
+    using Integer_array = computoc::Array<int>;
+
+    const int data[] = {
+        1, 2, 3,
+        4, 5, 6 };
+    Integer_array arr{ { 2, 3 }, data };
+
+    const int row_data[] = { 10, 20, 30 };
+    Integer_array row{ { 1, 3 }, row_data };
+
+    const int col_data[] = { 100, 200 };
+    Integer_array col{ { 2, 1 }, col_data };
+
+    const int rdata1[] = {
+        11, 22, 33,
+        14, 25, 36 };
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 3 }, rdata1), arr + row));
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 3 }, rdata1), row + arr));
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 3 }, rdata1), arr + Integer_array({ 3 }, row_data)));
+
+    const int rdata2[] = {
+        110, 120, 130,
+        210, 220, 230 };
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 3 }, rdata2), col + row));
+
+    const bool rdata3[] = {
+        false, false, false,
+        true, true, true };
+    EXPECT_TRUE(computoc::all_equal(computoc::Array<bool>({ 2, 3 }, rdata3), arr > Integer_array({ 1 }, 3)));
+
+    Integer_array sarr{ arr({ {0, 1}, {0, 2, 2} }) };
+    const int rdata4[] = {
+        101, 103,
+        204, 206 };
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 2 }, rdata4), sarr + col));
+
+    computoc::Thread_pool pool{ 4 };
+    computoc::Parallel_execution_policy policy{ &pool, 4 };
+    EXPECT_TRUE(computoc::all_equal(col + row, computoc::transform(policy, col, row, std::plus<>{})));
+
+    Integer_array carr{ computoc::clone(arr) };
+    carr += row;
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 3 }, rdata1), carr));
+    carr += Integer_array({ 2, 2 }, 0);
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 3 }, rdata1), carr));
+
+    EXPECT_TRUE(computoc::empty(arr + Integer_array({ 2 }, 0)));
+    row += col;
+    EXPECT_TRUE(computoc::all_equal(Integer_array({ 1, 3 }, row_data), row));
+}
+
 TEST(Array_test, reduce_elements)
 {
     std::int64_t dims[]{ 3, 1, 2 };
@@ -1151,6 +1609,31 @@ TEST(Array_test, reduce_elements)
 
         EXPECT_TRUE(computoc::all_equal(rarr1d, computoc::reduce(computoc::reduce(computoc::reduce(iarr, sum, 2), sum, 1), sum, 0)));
     }
+
+    // dense and parallel reduction by axis
+    {
+        computoc::Array arr3d{ {2, 2, 2}, {0, 1, 3, 4, 6, 7, 9, 10} };
+        EXPECT_TRUE(computoc::all_equal(computoc::Array{ {2, 2}, {6, 8, 12, 14} }, computoc::reduce(arr3d, std::plus<>{}, 0)));
+        EXPECT_TRUE(computoc::all_equal(computoc::Array{ {2, 2}, {3, 5, 15, 17} }, computoc::reduce(arr3d, std::plus<>{}, 1)));
+        EXPECT_TRUE(computoc::all_equal(computoc::Array{ {2, 2}, {1, 7, 13, 19} }, computoc::reduce(arr3d, std::plus<>{}, 2)));
+
+        computoc::Array<int> arr{ { 4, 6, 40 } };
+        for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+            arr.data()[i] = static_cast<int>(i % 17);
+        }
+        computoc::Array<int> sarr{ arr({ {0, 2}, {0, 4}, {0, 38} }) };
+        computoc::Array<int> darr{ computoc::clone(sarr) };
+
+        computoc::Thread_pool pool{ 3 };
+        computoc::Parallel_execution_policy policy{ &pool, 8 };
+
+        for (std::int64_t axis : { 0, 1, 2 }) {
+            EXPECT_TRUE(computoc::all_equal(computoc::reduce(sarr, std::minus<>{}, axis), computoc::reduce(darr, std::minus<>{}, axis)));
+            EXPECT_TRUE(computoc::all_equal(computoc::reduce(sarr, std::plus<>{}, axis), computoc::reduce(darr, std::plus<>{}, axis)));
+            EXPECT_TRUE(computoc::all_equal(computoc::reduce(sarr, std::plus<>{}, axis), computoc::reduce(policy, sarr, std::plus<>{}, axis)));
+            EXPECT_TRUE(computoc::all_equal(computoc::reduce(sarr, [](int value, double previous) {return previous + value; }, axis), computoc::reduce(policy, darr, [](int value, double previous) {return previous + value; }, axis)));
+        }
+    }
 }
 
 TEST(Array_test, all)
@@ -1445,6 +1928,202 @@ TEST(Array_test, transpose)
     EXPECT_TRUE(computoc::empty(computoc::transpose(iarr, { 2, 0, 1, 4 })));
 }
 
+TEST(Array_test, transpose_of_large_arrays_by_blocks)
+{
+    computoc::Thread_pool pool{ 4 };
+    computoc::Parallel_execution_policy policy{ &pool, 64 };
+
+    computoc::Array<float> farr{ { 37, 70 } };
+    for (std::int64_t i = 0; i < farr.header().count(); ++i) {
+        farr.data()[i] = static_cast<float>(i);
+    }
+
+    computoc::Array<float> rfarr{ { 70, 37 } };
+    for (std::int64_t i = 0; i < 37; ++i) {
+        for (std::int64_t j = 0; j < 70; ++j) {
+            rfarr.data()[j * 37 + i] = farr.data()[i * 70 + j];
+        }
+    }
+
+    EXPECT_TRUE(computoc::all_equal(rfarr, computoc::transpose(farr, { 1, 0 })));
+    EXPECT_TRUE(computoc::all_equal(rfarr, computoc::transpose(policy, farr, { 1, 0 })));
+    EXPECT_TRUE(computoc::all_equal(farr, computoc::transpose(computoc::transpose(farr, { 1, 0 }), { 1, 0 })));
+
+    const std::int64_t dims[]{ 5, 19, 43 };
+    computoc::Array<double> darr{ { dims, 3 } };
+    for (std::int64_t i = 0; i < darr.header().count(); ++i) {
+        darr.data()[i] = static_cast<double>(i);
+    }
+
+    const std::int64_t orders[][3]{ { 2, 1, 0 }, { 0, 2, 1 }, { 1, 2, 0 }, { 1, 0, 2 } };
+    for (const auto& order : orders) {
+        const std::int64_t rdims[]{ dims[order[0]], dims[order[1]], dims[order[2]] };
+        computoc::Array<double> rdarr{ { rdims, 3 } };
+        for (std::int64_t i = 0; i < rdims[0]; ++i) {
+            for (std::int64_t j = 0; j < rdims[1]; ++j) {
+                for (std::int64_t k = 0; k < rdims[2]; ++k) {
+                    std::int64_t subs[3]{};
+                    subs[order[0]] = i;
+                    subs[order[1]] = j;
+                    subs[order[2]] = k;
+                    rdarr.data()[(i * rdims[1] + j) * rdims[2] + k] = darr.data()[(subs[0] * dims[1] + subs[1]) * dims[2] + subs[2]];
+                }
+            }
+        }
+
+        EXPECT_TRUE(computoc::all_equal(rdarr, computoc::transpose(darr, std::span<const std::int64_t>(order, 3))));
+        EXPECT_TRUE(computoc::all_equal(rdarr, computoc::transpose(policy, darr, std::span<const std::int64_t>(order, 3))));
+        auto to_int = [](double d) { return static_cast<int>(d); };
+        EXPECT_TRUE(computoc::all_equal(computoc::transform(rdarr, to_int), computoc::transpose(computoc::transform(darr, to_int), std::span<const std::int64_t>(order, 3))));
+    }
+
+    computoc::Array<float> sfarr{ farr({ {1, 36, 2}, {3, 66} }) };
+    EXPECT_TRUE(computoc::all_equal(computoc::transpose(computoc::clone(sfarr), { 1, 0 }), computoc::transpose(sfarr, { 1, 0 })));
+    EXPECT_TRUE(computoc::all_equal(computoc::transpose(computoc::clone(sfarr), { 1, 0 }), computoc::transpose(policy, sfarr, { 1, 0 })));
+}
+
+#if defined(__unix__)
+TEST(Array_test, memory_mapped_arrays)
+{
+    const std::string path{ (std::filesystem::temp_directory_path() / "computoc_memory_mapped_arrays.bin").string() };
+
+    const std::int64_t header[]{ 12 };
+    const int data[]{
+        1, 2, 3, 4,
+        5, 6, 7, 8,
+        9, 10, 11, 12 };
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(header), sizeof(header));
+        ofs.write(reinterpret_cast<const char*>(data), sizeof(data));
+    }
+
+    {
+        computoc::Array<int> arr{ computoc::map_file<int>(path, { 3, 4 }, sizeof(header)) };
+        EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 3, 4 }, data), arr));
+        EXPECT_TRUE(computoc::advise(arr, computoc::Access_advice::sequential));
+
+        computoc::Array<int> sarr{ arr({ {1, 2}, {1, 3, 2} }) };
+        const int rdata[]{ 6, 8, 10, 12 };
+        EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 2, 2 }, rdata), sarr));
+        EXPECT_TRUE(computoc::advise(sarr, computoc::Access_advice::random));
+        EXPECT_EQ(78, computoc::reduce(arr, std::plus<>{}));
+        EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 3, 4 }, data) * 2, arr + arr));
+
+        computoc::Array<int> carr{ computoc::map_file<int>(path, { 3, 4 }, sizeof(header), computoc::Map_mode::copy_on_write) };
+        carr({ {0, 0}, {0, 3} }) = 0;
+        EXPECT_EQ(0, carr.data()[3]);
+        EXPECT_EQ(4, arr.data()[3]);
+
+        // dont_need would discard the private writes of a copy-on-write mapping
+        EXPECT_FALSE(computoc::advise(carr, computoc::Access_advice::dont_need));
+        EXPECT_TRUE(computoc::advise(carr({ {1, 2} }), computoc::Access_advice::will_need));
+        EXPECT_EQ(0, carr.data()[3]);
+
+        EXPECT_TRUE(computoc::advise(sarr({ {1, 1}, {1, 1} }), computoc::Access_advice::dont_need));
+        EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 2, 2 }, rdata), sarr));
+
+        // arrays that are not mapped from a file are never advised
+        computoc::Array<int> harr({ 3, 4 }, data);
+        EXPECT_FALSE(computoc::advise(harr, computoc::Access_advice::dont_need));
+        EXPECT_FALSE(computoc::advise(harr({ {1, 2} }), computoc::Access_advice::sequential));
+        EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 3, 4 }, data), harr));
+
+        computoc::Array<int> aarr{ computoc::append(arr, harr) };
+        EXPECT_FALSE(computoc::advise(aarr, computoc::Access_advice::will_need));
+    }
+
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        int file_data[12]{};
+        ifs.seekg(sizeof(header));
+        ifs.read(reinterpret_cast<char*>(file_data), sizeof(file_data));
+        EXPECT_TRUE(std::equal(std::begin(data), std::end(data), std::begin(file_data)));
+    }
+
+    EXPECT_TRUE(computoc::empty(computoc::map_file<int>(path, { 4, 4 }, sizeof(header))));
+    EXPECT_TRUE(computoc::empty(computoc::map_file<int>(path, { 3, 4 }, 2)));
+    EXPECT_TRUE(computoc::empty(computoc::map_file<int>(path + ".missing", { 3, 4 })));
+
+    std::filesystem::remove(path);
+}
+#endif
+
+TEST(Array_test, npy_serialization)
+{
+    const std::string path{ (std::filesystem::temp_directory_path() / "computoc_npy_serialization.npy").string() };
+
+    const std::int64_t dims[]{ 2, 3, 4 };
+    computoc::Array<double> darr{ { dims, 3 } };
+    for (std::int64_t i = 0; i < darr.header().count(); ++i) {
+        darr.data()[i] = 1.0 / (i + 1);
+    }
+
+    EXPECT_TRUE(computoc::save(path, darr));
+    EXPECT_TRUE(computoc::all_equal(darr, computoc::load<double>(path)));
+    EXPECT_TRUE(computoc::empty(computoc::load<float>(path)));
+
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        std::string header(128, '\0');
+        ifs.read(header.data(), header.size());
+        EXPECT_EQ(0, header.find("\x93NUMPY\x01\x00"));
+        EXPECT_NE(std::string::npos, header.find("{'descr': '<f8', 'fortran_order': False, 'shape': (2, 3, 4), }"));
+        EXPECT_EQ('\n', header[127]);
+    }
+
+    computoc::Array<double> sarr{ darr({ {0, 1}, {0, 2, 2}, {1, 3} }) };
+    EXPECT_TRUE(computoc::save(path, sarr));
+    EXPECT_TRUE(computoc::all_equal(sarr, computoc::load<double>(path)));
+
+    computoc::Array<bool> barr{ { 5 }, { true, false, false, true, true } };
+    EXPECT_TRUE(computoc::save(path, barr));
+    EXPECT_TRUE(computoc::all_equal(barr, computoc::load<bool>(path)));
+
+    {
+        computoc::Npy_writer<int> writer(path, { 3, 2 });
+        const int rdata[]{ 1, 2, 3, 4, 5, 6 };
+        computoc::Array<int> arr{ { 3, 2 }, rdata };
+        for (std::int64_t i = 0; i < 3; ++i) {
+            EXPECT_TRUE(writer);
+            EXPECT_TRUE(writer.write(computoc::reshape(arr({ {i, i} }), { 2 })));
+        }
+        EXPECT_FALSE(writer);
+        EXPECT_FALSE(writer.write(computoc::Array<int>({ 2 }, 0)));
+        EXPECT_EQ(3, writer.num_written());
+    }
+    {
+        computoc::Npy_reader<int> reader(path);
+        EXPECT_TRUE(std::ranges::equal(std::vector<std::int64_t>{ 3, 2 }, reader.dims()));
+        int expected{ 1 };
+        while (reader) {
+            computoc::Array<int> slice{ reader.read() };
+            EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 2 }, { expected, expected + 1 }), slice));
+            expected += 2;
+        }
+        EXPECT_EQ(3, reader.num_read());
+        EXPECT_TRUE(computoc::empty(reader.read()));
+    }
+
+    {
+        const std::string header{ "{'descr': '<i4', 'fortran_order': True, 'shape': (2, 3), }" };
+        std::string padded_header{ header + std::string(64 - (10 + header.size() + 1) % 64, ' ') + "\n" };
+        const int column_major_data[]{ 1, 4, 2, 5, 3, 6 };
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write("\x93NUMPY\x01\x00", 8);
+        const char header_size[]{ static_cast<char>(padded_header.size()), 0 };
+        ofs.write(header_size, 2);
+        ofs.write(padded_header.data(), padded_header.size());
+        ofs.write(reinterpret_cast<const char*>(column_major_data), sizeof(column_major_data));
+    }
+    EXPECT_TRUE(computoc::all_equal(computoc::Array<int>({ 2, 3 }, { 1, 2, 3, 4, 5, 6 }), computoc::load<int>(path)));
+    EXPECT_FALSE(computoc::Npy_reader<int>(path));
+
+    EXPECT_TRUE(computoc::empty(computoc::load<int>(path + ".missing")));
+
+    std::filesystem::remove(path);
+}
+
 TEST(Array_test, equal)
 {
     using Integer_array = computoc::Array<int>;
@@ -1468,7 +2147,7 @@ TEST(Array_test, equal)
     computoc::Array<bool> rarr{ {3, 1, 2}, rdata };
     
     EXPECT_TRUE(computoc::all_equal(rarr, arr1 == arr2));
-    EXPECT_TRUE(computoc::empty(arr1 == Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 == Integer_array{ {4} }));
 }
 
 TEST(Array_test, not_equal)
@@ -1494,7 +2173,7 @@ TEST(Array_test, not_equal)
     computoc::Array<bool> rarr{ {3, 1, 2}, rdata };
 
     EXPECT_TRUE(computoc::all_equal(rarr, arr1 != arr2));
-    EXPECT_TRUE(computoc::empty(arr1 != Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 != Integer_array{ {4} }));
 }
 
 TEST(Array_test, greater)
@@ -1522,7 +2201,7 @@ TEST(Array_test, greater)
     EXPECT_TRUE(computoc::all_equal(rarr, arr1 > arr2));
     EXPECT_TRUE(computoc::all_equal(rarr, arr1 > 6));
     EXPECT_TRUE(computoc::all_equal(rarr, 0 > arr1));
-    EXPECT_TRUE(computoc::empty(arr1 > Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 > Integer_array{ {4} }));
 }
 
 TEST(Array_test, greater_equal)
@@ -1558,7 +2237,7 @@ TEST(Array_test, greater_equal)
 
     EXPECT_TRUE(computoc::all_equal(rarr2, 5 >= arr2));
 
-    EXPECT_TRUE(computoc::empty(arr1 >= Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 >= Integer_array{ {4} }));
 }
 
 TEST(Array_test, less)
@@ -1594,7 +2273,7 @@ TEST(Array_test, less)
 
     EXPECT_TRUE(computoc::all_equal(rarr2, 1 < arr2));
 
-    EXPECT_TRUE(computoc::empty(arr1 < Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 < Integer_array{ {4} }));
 }
 
 TEST(Array_test, less_equal)
@@ -1622,7 +2301,7 @@ TEST(Array_test, less_equal)
     EXPECT_TRUE(computoc::all_equal(rarr, arr1 <= arr2));
     EXPECT_TRUE(computoc::all_equal(rarr, arr1 <= 5));
     EXPECT_TRUE(computoc::all_equal(rarr, 0 <= arr1));
-    EXPECT_TRUE(computoc::empty(arr1 <= Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 <= Integer_array{ {4} }));
 }
 
 TEST(Array_test, close)
@@ -1650,7 +2329,7 @@ TEST(Array_test, close)
     EXPECT_TRUE(computoc::all_equal(rarr, computoc::close(arr1, arr2, 2)));
     EXPECT_TRUE(computoc::all_equal(rarr, computoc::close(arr1, 3, 2)));
     EXPECT_TRUE(computoc::all_equal(rarr, computoc::close(3, arr1, 2)));
-    EXPECT_TRUE(computoc::empty(computoc::close(arr1, Integer_array{ {1} })));
+    EXPECT_TRUE(computoc::empty(computoc::close(arr1, Integer_array{ {4} })));
 }
 
 TEST(Array_test, plus)
@@ -1679,8 +2358,8 @@ TEST(Array_test, plus)
     arr1 += arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 + Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 += Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 + Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 += Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         11, 12,
@@ -1720,8 +2399,8 @@ TEST(Array_test, minus)
     arr1 -= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 - Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 -= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 - Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 -= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0, 1,
@@ -1768,8 +2447,8 @@ TEST(Array_test, multiply)
     arr1 *= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 * Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 *= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 * Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 *= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         10, 20,
@@ -1809,8 +2488,8 @@ TEST(Array_test, divide)
     arr1 /= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 / Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 /= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 / Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 /= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0, 1,
@@ -1857,8 +2536,8 @@ TEST(Array_test, modulu)
     arr1 %= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 % Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 %= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 % Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 %= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         1, 0,
@@ -1905,8 +2584,8 @@ TEST(Array_test, xor)
     arr1 ^= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 ^ Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 ^= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 ^ Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 ^= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0b111, 0b110,
@@ -1946,8 +2625,8 @@ TEST(Array_test, and)
     arr1 &= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 & Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 &= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 & Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 &= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0b000, 0b001,
@@ -1987,8 +2666,8 @@ TEST(Array_test, or)
     arr1 |= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 | Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 |= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 | Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 |= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0b111, 0b111,
@@ -2028,8 +2707,8 @@ TEST(Array_test, shift_left)
     arr1 <<= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 << Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 <<= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 << Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 <<= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0, 4,
@@ -2076,8 +2755,8 @@ TEST(Array_test, shift_right)
     arr1 >>= arr2;
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1));
 
-    EXPECT_TRUE(computoc::empty(arr1 >> Integer_array{ {1} }));
-    EXPECT_TRUE(computoc::all_equal(arr1 >>= Integer_array{ {1} }, arr1));
+    EXPECT_TRUE(computoc::empty(arr1 >> Integer_array{ {4} }));
+    EXPECT_TRUE(computoc::all_equal(arr1 >>= Integer_array{ {4} }, arr1));
 
     const int rdata2[] = {
         0, 0,
@@ -2196,7 +2875,7 @@ TEST(Array_test, logic_and)
 
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1 && arr2));
 
-    EXPECT_TRUE(computoc::empty(arr1 && Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 && Integer_array{ {4} }));
 
     const int rdata2[] = {
         0, 1,
@@ -2232,7 +2911,7 @@ TEST(Array_test, logic_or)
 
     EXPECT_TRUE(computoc::all_equal(rarr1, arr1 || arr2));
 
-    EXPECT_TRUE(computoc::empty(arr1 || Integer_array{ {1} }));
+    EXPECT_TRUE(computoc::empty(arr1 || Integer_array{ {4} }));
 
     const int rdata2[] = {
         1, 1,
@@ -2986,6 +3665,537 @@ TEST(Array_test, clone)
     EXPECT_FALSE(computoc::all_equal(sarr({ {1, 1}, {0, 0}, {0, 0} }), csubarr));
 }
 
+TEST(Array_test, data_is_aligned_to_a_cache_line)
+{
+    for (std::int64_t n : { 1, 3, 17, 1000 }) {
+        computoc::Array<char> carr{ {n}, 'a' };
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(carr.data()) % 64);
+
+        computoc::Array<double> darr{ {n, 3}, 1.0 };
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(darr.data()) % 64);
+        computoc::Array<double> rarr{ darr + darr };
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(rarr.data()) % 64);
+    }
+
+    // only element buffers are over-aligned, internal allocations keep the alignment of their type
+    EXPECT_EQ(alignof(std::int64_t), computoc::details::Lightweight_stl_allocator<std::int64_t>::alignment);
+    EXPECT_EQ(64, computoc::details::Lightweight_stl_allocator<std::int64_t>::data_buffer_alignment);
+    EXPECT_EQ(alignof(std::int64_t), computoc::Arena_allocator<std::int64_t>::alignment);
+
+    computoc::details::Lightweight_stl_allocator<char> allocator;
+    char* buffer{ allocator.allocate(3, computoc::details::data_buffer) };
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(buffer) % 64);
+    allocator.deallocate(buffer, 3, computoc::details::data_buffer);
+
+    {
+        computoc::Arena_scope scope;
+        using Arena_array = computoc::Array<char, computoc::dynamic_sequence, computoc::dynamic_sequence, computoc::Arena_allocator, computoc::Arena_allocator>;
+        Arena_array first{ {3}, 'a' };
+        Arena_array second{ {3}, 'b' };
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(first.data()) % 64);
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(second.data()) % 64);
+    }
+}
+
+template <typename T>
+class Counting_allocator : public std::allocator<T> {
+public:
+    inline static std::int64_t allocations{ 0 };
+
+    Counting_allocator() = default;
+    template <typename U>
+    Counting_allocator(const Counting_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        ++Counting_allocator<char>::allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+TEST(Array_test, slicing_stores_up_to_eight_dims_inline)
+{
+    using Integer_array = computoc::Array<int, computoc::dynamic_sequence, computoc::dynamic_sequence, std::allocator, Counting_allocator>;
+
+    const int data[] = {
+        1, 2, 3,
+        4, 5, 6,
+
+        7, 8, 9,
+        10, 11, 12 };
+    const Integer_array arr{ {2, 2, 3}, data };
+    EXPECT_TRUE(arr.header().dims().size() <= computoc::details::inline_dims_capacity);
+
+    Counting_allocator<char>::allocations = 0;
+    {
+        Integer_array sarr{ arr({ {0, 1}, {1, 1}, {0, 2, 2} }) };
+        const int rdata[] = { 4, 6, 10, 12 };
+        EXPECT_TRUE(computoc::all_equal(Integer_array{ {2, 1, 2}, rdata }, sarr));
+        Counting_allocator<char>::allocations = 0;
+
+        Integer_array ssarr{ sarr({ {1, 1} }) };
+        EXPECT_EQ(12, ssarr({ 0, 0, 1 }));
+
+        std::int64_t count{ 0 };
+        for (computoc::details::Array_indices_generator gen(sarr.header()); gen; ++gen) {
+            ++count;
+        }
+        EXPECT_EQ(4, count);
+    }
+    EXPECT_EQ(0, Counting_allocator<char>::allocations);
+
+    const Integer_array harr{ {1, 1, 1, 1, 1, 1, 1, 1, 1, 2}, data };
+    Counting_allocator<char>::allocations = 0;
+    Integer_array sharr{ harr({ {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {1, 1} }) };
+    EXPECT_EQ(2, sharr({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }));
+    EXPECT_LT(0, Counting_allocator<char>::allocations);
+}
+
+TEST(Array_test, fixed_rank_view)
+{
+    using Integer_array = computoc::Array<int>;
+
+    const int data[] = {
+        1, 2, 3,
+        4, 5, 6,
+
+        7, 8, 9,
+        10, 11, 12 };
+    Integer_array arr{ {2, 2, 3}, data };
+
+    computoc::Fixed_rank_array<int, 3> farr{ arr };
+    EXPECT_FALSE(farr.empty());
+    EXPECT_EQ(12, farr.count());
+    EXPECT_EQ((std::array<std::int64_t, 3>{ 2, 2, 3 }), farr.dims());
+    EXPECT_EQ((std::array<std::int64_t, 3>{ 6, 3, 1 }), farr.strides());
+    EXPECT_EQ(6, farr(0, 1, 2));
+    EXPECT_EQ(12, farr(-1, -1, -1));
+    EXPECT_EQ(arr({ 1, 0, 1 }), farr(1, 0, 1));
+
+    farr(1, 1, 0) = 100;
+    EXPECT_EQ(100, arr({ 1, 1, 0 }));
+    EXPECT_EQ(arr.data(), farr.array().data());
+
+    EXPECT_TRUE((computoc::Fixed_rank_array<int, 2>(arr).empty()));
+    EXPECT_TRUE((computoc::Fixed_rank_array<int, 2>{}.empty()));
+
+    computoc::Fixed_rank_array<int, 3> sarr{ arr({ {0, 1}, {1, 1}, {0, 2, 2} }) };
+    EXPECT_EQ((std::array<std::int64_t, 3>{ 2, 1, 2 }), sarr.dims());
+    EXPECT_EQ(6, sarr(0, 0, 1));
+    EXPECT_EQ(12, sarr(1, 0, 1));
+
+    std::vector<int> values;
+    sarr.for_each([&values](int value) { values.push_back(value); });
+    EXPECT_EQ((std::vector<int>{ 4, 6, 100, 12 }), values);
+
+    farr.for_each([](int& value) { value *= 2; });
+    EXPECT_EQ(2, arr({ 0, 0, 0 }));
+    EXPECT_EQ(24, arr({ 1, 1, 2 }));
+
+    computoc::Fixed_rank_array<double, 2> zarr{ std::array<std::int64_t, 2>{ 3, 4 }, 0.5 };
+    EXPECT_EQ(0.5, zarr(2, 3));
+    EXPECT_TRUE(computoc::all_equal(computoc::Array<double>{ {3, 4}, 0.5 }, zarr.array()));
+
+    // growing an array sharing the buffer of the view leaves the view with the previous buffer
+    {
+        Integer_array garr{ {2, 3}, data };
+        computoc::Fixed_rank_array<int, 2> gfarr{ garr };
+        const int* prev_data = garr.data();
+        for (int i = 0; i < 8; ++i) {
+            garr.append_inplace(Integer_array{ {1, 3}, data });
+        }
+        EXPECT_NE(prev_data, garr.data());
+        EXPECT_EQ(prev_data, gfarr.array().data());
+        EXPECT_EQ(6, gfarr(1, 2));
+        gfarr(0, 0) = 50;
+        EXPECT_EQ(1, garr({ 0, 0 }));
+        int sum{ 0 };
+        gfarr.for_each([&sum](int value) { sum += value; });
+        EXPECT_EQ(70, sum);
+    }
+}
+
+TEST(Array_test, unchecked_element_access)
+{
+    using Integer_array = computoc::Array<int>;
+
+    const int data[] = {
+        1, 2, 3,
+        4, 5, 6,
+
+        7, 8, 9,
+        10, 11, 12 };
+    Integer_array arr{ {2, 2, 3}, data };
+
+    EXPECT_EQ(6, std::as_const(arr).at_unchecked({ 0, 1, 2 }));
+    EXPECT_EQ(arr({ 1, 0, 1 }), arr.at_unchecked({ 1, 0, 1 }));
+    EXPECT_EQ(9, arr.at_unchecked(8));
+
+    arr.at_unchecked({ 1, 1, 0 }) = 100;
+    EXPECT_EQ(100, arr({ 1, 1, 0 }));
+
+    const Integer_array sarr{ arr({ {0, 1}, {1, 1}, {0, 2, 2} }) };
+    EXPECT_EQ(6, sarr.at_unchecked({ 0, 0, 1 }));
+    EXPECT_EQ(12, sarr.at_unchecked({ 1, 0, 1 }));
+
+    Integer_array carr{ computoc::clone(arr, computoc::copy_on_write) };
+    carr.at_unchecked({ 0, 0, 0 }) = 50;
+    EXPECT_EQ(1, arr({ 0, 0, 0 }));
+    EXPECT_EQ(50, carr({ 0, 0, 0 }));
+
+    computoc::Fixed_rank_array<int, 3> farr{ sarr };
+    EXPECT_EQ(4, farr.at_unchecked(0, 0, 0));
+    EXPECT_EQ(12, farr.at_unchecked(1, 0, 1));
+    farr.at_unchecked(1, 0, 0) = 200;
+    EXPECT_EQ(200, arr({ 1, 1, 0 }));
+}
+
+TEST(Array_test, bit_packed_masks)
+{
+    using Integer_array = computoc::Array<int>;
+    using Bool_array = computoc::Array<bool>;
+
+    std::vector<int> data(130);
+    std::iota(data.begin(), data.end(), 0);
+    const Integer_array arr{ {2, 65}, std::as_const(data).data() };
+
+    const computoc::Bit_mask<> even{ computoc::pack(arr, [](int a) { return a % 2 == 0; }) };
+    EXPECT_EQ(3, even.num_words());
+    EXPECT_EQ(65, even.count_set());
+    EXPECT_TRUE(even.test(128));
+    EXPECT_FALSE(even.test(129));
+    EXPECT_TRUE(computoc::any(even));
+    EXPECT_FALSE(computoc::all(even));
+    EXPECT_TRUE(computoc::all_equal(arr % 2 == 0, computoc::unpack(even)));
+
+    const Bool_array large{ arr >= 100 };
+    const computoc::Bit_mask<> packed_large{ computoc::pack(large) };
+    EXPECT_EQ(30, packed_large.count_set());
+    EXPECT_TRUE(computoc::all_equal(large, computoc::unpack(packed_large)));
+
+    const computoc::Bit_mask<> odd{ !even };
+    EXPECT_EQ(65, odd.count_set());
+    EXPECT_FALSE(computoc::any(even && odd));
+    EXPECT_TRUE(computoc::all(even || odd));
+    EXPECT_FALSE(computoc::any(computoc::pack(arr, [](int a) { return a < 0; })));
+    EXPECT_TRUE(computoc::all(computoc::pack(arr, [](int a) { return a >= 0; })));
+
+    const Integer_array filtered{ computoc::filter(arr, even && packed_large) };
+    EXPECT_TRUE(computoc::all_equal(computoc::filter(arr, (arr % 2 == 0) && (arr >= 100)), filtered));
+    EXPECT_EQ(15, filtered.header().count());
+    EXPECT_EQ(100, filtered({ 0 }));
+    EXPECT_EQ(128, filtered({ 14 }));
+
+    const Integer_array found{ computoc::find(arr, odd && packed_large) };
+    EXPECT_TRUE(computoc::all_equal(computoc::find(arr, (arr % 2 == 1) && (arr >= 100)), found));
+
+    const Integer_array sarr{ arr({ {0, 1}, {1, 63, 2} }) };
+    const computoc::Bit_mask<> small{ computoc::pack(sarr, [](int a) { return a < 10; }) };
+    EXPECT_EQ(5, small.count_set());
+    EXPECT_TRUE(computoc::all_equal(computoc::filter(sarr, [](int a) { return a < 10; }), computoc::filter(sarr, small)));
+    EXPECT_TRUE(computoc::all_equal(computoc::find(sarr, [](int a) { return a < 10; }), computoc::find(sarr, small)));
+
+    EXPECT_TRUE(computoc::empty(computoc::filter(arr, small)));
+    EXPECT_TRUE(computoc::empty(even && small));
+    EXPECT_TRUE(computoc::empty(computoc::pack(Integer_array{})));
+    EXPECT_TRUE(computoc::all(computoc::Bit_mask<>{}));
+    EXPECT_FALSE(computoc::any(computoc::Bit_mask<>{}));
+}
+
+TEST(Array_test, expiring_operands_buffers_are_reused)
+{
+    using Double_array = computoc::Array<double>;
+    using Integer_array = computoc::Array<int>;
+
+    const double data[] = {
+        1.0, 2.0, 3.0,
+        4.0, 5.0, 6.0 };
+    const Double_array a{ {2, 3}, data };
+    const Double_array b{ {2, 3}, 1.0 };
+    const Double_array c{ {2, 3}, 2.0 };
+
+    {
+        Double_array t{ a + b };
+        EXPECT_TRUE(t.is_reusable());
+        const double* t_data_ptr{ t.data() };
+        Double_array r{ std::move(t) * c };
+        EXPECT_EQ(t_data_ptr, r.data());
+        EXPECT_TRUE(computoc::all_equal((a + b) * c, r));
+    }
+
+    {
+        Double_array t{ a + b };
+        const double* t_data_ptr{ t.data() };
+        Double_array r{ 10.0 - std::move(t) };
+        EXPECT_EQ(t_data_ptr, r.data());
+        const double rdata[] = {
+            8.0, 7.0, 6.0,
+            5.0, 4.0, 3.0 };
+        EXPECT_TRUE(computoc::all_equal(Double_array{ {2, 3}, rdata }, r));
+    }
+
+    {
+        Double_array t{ a * 2.0 };
+        const double* t_data_ptr{ t.data() };
+        Double_array r{ computoc::sqrt(-(-std::move(t))) };
+        EXPECT_EQ(t_data_ptr, r.data());
+        EXPECT_TRUE(computoc::all_close(computoc::sqrt(a * 2.0), r));
+    }
+
+    {
+        Double_array t{ a + b };
+        const double* t_data_ptr{ t.data() };
+        Double_array r{ a({ {0, 1}, {0, 2} }) - std::move(t) };
+        EXPECT_EQ(t_data_ptr, r.data());
+        EXPECT_TRUE(computoc::all_equal(Double_array{ {2, 3}, -1.0 }, r));
+    }
+
+    // shared, strided and broadcast operands are not reused
+    {
+        Double_array s{ a };
+        EXPECT_FALSE(s.is_reusable());
+        Double_array r{ std::move(s) + b };
+        EXPECT_NE(a.data(), r.data());
+        EXPECT_TRUE(computoc::all_equal(Double_array{ {2, 3}, data }, a));
+
+        Double_array sr{ a({ {0, 1}, {0, 2, 2} }) + 1.0 };
+        EXPECT_NE(a.data(), sr.data());
+        EXPECT_TRUE(computoc::all_equal(Double_array{ {2, 3}, data }, a));
+
+        Double_array t{ {1, 3}, 1.0 };
+        const double* t_data_ptr{ t.data() };
+        Double_array br{ std::move(t) + a };
+        EXPECT_NE(t_data_ptr, br.data());
+        EXPECT_TRUE(computoc::all_equal(a + 1.0, br));
+    }
+
+    // different result type
+    {
+        Integer_array t{ {2, 3}, 1 };
+        const auto r{ std::move(t) + 0.5 };
+        EXPECT_TRUE(computoc::all_equal(Double_array{ {2, 3}, 1.5 }, r));
+    }
+}
+
+struct Default_counted {
+    static inline int default_constructions = 0;
+
+    Default_counted() : value(0) { ++default_constructions; }
+    Default_counted(int v) : value(v) {}
+
+    int value;
+};
+
+TEST(Array_test, uninitialized_allocation)
+{
+    using Counted_array = computoc::Array<Default_counted>;
+
+    Default_counted::default_constructions = 0;
+    Counted_array initialized{ {6} };
+    EXPECT_EQ(6, Default_counted::default_constructions);
+
+    Default_counted::default_constructions = 0;
+    Counted_array arr{ {6}, computoc::uninitialized };
+    EXPECT_EQ(0, Default_counted::default_constructions);
+    EXPECT_EQ(6, arr.header().count());
+    for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+        arr.data()[i] = Default_counted{ static_cast<int>(i) };
+    }
+
+    const auto doubled{ computoc::transform(arr, [](const Default_counted& e) { return Default_counted{ e.value * 2 }; }) };
+    const auto cloned{ computoc::clone(arr) };
+    const auto appended{ computoc::append(arr, arr) };
+    const auto removed{ computoc::remove(arr, 0, 1) };
+    EXPECT_EQ(0, Default_counted::default_constructions);
+
+    const auto resized{ computoc::resize(arr, { 8 }) };
+    EXPECT_EQ(5, resized.data()[5].value);
+    EXPECT_EQ(0, resized.data()[7].value);
+
+    for (std::int64_t i = 0; i < arr.header().count(); ++i) {
+        EXPECT_EQ(2 * i, doubled.data()[i].value);
+        EXPECT_EQ(i, cloned.data()[i].value);
+        EXPECT_EQ(i, appended.data()[i].value);
+        EXPECT_EQ(i, appended.data()[i + 6].value);
+    }
+    for (std::int64_t i = 0; i < removed.header().count(); ++i) {
+        EXPECT_EQ(i + 1, removed.data()[i].value);
+    }
+
+    // types that are not trivially copyable are still default constructed
+    computoc::Array<std::string> strings{ {2}, computoc::uninitialized };
+    strings.data()[0] += "a";
+    EXPECT_EQ("a", strings.data()[0]);
+    EXPECT_TRUE(strings.data()[1].empty());
+
+    // arithmetic results are unaffected
+    const double data[] = { 1.0, 2.0, 3.0, 4.0 };
+    const computoc::Array<double> a{ {2, 2}, data };
+    const double rdata[] = { 2.0, 4.0, 6.0, 8.0 };
+    EXPECT_TRUE(computoc::all_equal(computoc::Array<double>({ 2, 2 }, rdata), a + a));
+}
+
+TEST(Array_test, copy_on_write_clone)
+{
+    using Integer_array = computoc::Array<int>;
+
+    const int data[] = {
+        1, 2,
+        3, 4,
+        5, 6 };
+    const Integer_array arr{ {3, 2}, data };
+
+    Integer_array carr{ computoc::clone(arr, computoc::copy_on_write) };
+    EXPECT_TRUE(carr.is_copy_on_write());
+    EXPECT_EQ(arr.data(), std::as_const(carr).data());
+    EXPECT_EQ(3, std::as_const(carr)({ 1, 0 }));
+    EXPECT_TRUE(computoc::all_equal(arr, carr));
+
+    // copies of a copy-on-write clone alias it, and are written together
+    Integer_array ccarr{ carr };
+    EXPECT_TRUE(ccarr.is_copy_on_write());
+
+    carr({ 1, 0 }) = 0;
+    EXPECT_FALSE(carr.is_copy_on_write());
+    EXPECT_FALSE(ccarr.is_copy_on_write());
+    EXPECT_NE(arr.data(), std::as_const(carr).data());
+    EXPECT_EQ(std::as_const(carr).data(), std::as_const(ccarr).data());
+    EXPECT_EQ(3, arr({ 1, 0 }));
+    EXPECT_EQ(0, carr({ 1, 0 }));
+    EXPECT_EQ(0, ccarr({ 1, 0 }));
+
+    ccarr += 1;
+    EXPECT_TRUE(computoc::all_equal(arr, Integer_array{ {3, 2}, data }));
+    const int rdata[] = {
+        2, 3,
+        1, 5,
+        6, 7 };
+    EXPECT_TRUE(computoc::all_equal(ccarr, Integer_array{ {3, 2}, rdata }));
+    EXPECT_TRUE(computoc::all_equal(carr, Integer_array{ {3, 2}, rdata }));
+
+    {
+        Integer_array view{ computoc::clone(arr, computoc::copy_on_write) };
+        Integer_array copy{ view };
+        copy(0) = 7;
+        EXPECT_EQ(7, view(0));
+        EXPECT_EQ(1, arr(0));
+    }
+
+    // writes through the source, or through arrays sharing its buffer, do not affect the clone
+    {
+        Integer_array src{ {3, 2}, data };
+        Integer_array src_copy{ src };
+        Integer_array view{ computoc::clone(src, computoc::copy_on_write) };
+        Integer_array view_copy{ view };
+        EXPECT_EQ(std::as_const(src).data(), std::as_const(view).data());
+
+        src(0) = 5;
+        EXPECT_EQ(5, src_copy(0));
+        EXPECT_EQ(1, view(0));
+        EXPECT_EQ(1, view_copy(0));
+        EXPECT_NE(std::as_const(src).data(), std::as_const(view).data());
+
+        Integer_array second_view{ computoc::clone(src, computoc::copy_on_write) };
+        src_copy({ {1, 1} }) = 0;
+        EXPECT_EQ(3, second_view({ 1, 0 }));
+        EXPECT_EQ(0, src({ 1, 0 }));
+
+        Integer_array third_view{ computoc::clone(src, computoc::copy_on_write) };
+        src.append_inplace(Integer_array{ {1, 2}, data });
+        EXPECT_EQ(8, src.header().count());
+        EXPECT_EQ(6, third_view.header().count());
+        EXPECT_EQ(5, third_view(0));
+        EXPECT_EQ(0, third_view({ 1, 0 }));
+
+        // the clone writes to its own elements once the source has handed them over
+        view(1) = 20;
+        EXPECT_EQ(20, view_copy(1));
+        EXPECT_EQ(2, src(1));
+        const int rviewdata[] = {
+            1, 20,
+            3, 4,
+            5, 6 };
+        EXPECT_TRUE(computoc::all_equal(view, Integer_array{ {3, 2}, rviewdata }));
+    }
+
+    // subarrays of a copy-on-write clone, even through const access, write to the clone and not to its source
+    {
+        const Integer_array view{ computoc::clone(arr, computoc::copy_on_write) };
+        auto write_first = [](const Integer_array& x) {
+            Integer_array r{ x({ {0, 0} }) };
+            r = 99;
+        };
+        write_first(view);
+        EXPECT_EQ(1, arr({ 0, 0 }));
+        EXPECT_EQ(2, arr({ 0, 1 }));
+        EXPECT_EQ(99, view({ 0, 0 }));
+        EXPECT_EQ(99, view({ 0, 1 }));
+        EXPECT_EQ(3, view({ 1, 0 }));
+    }
+
+    // writing through a subarray of a clone copies only the viewed elements
+    Integer_array csubarr{ computoc::clone(arr({ {1, 2}, {1, 1} }), computoc::copy_on_write) };
+    csubarr({ {0, 0} }) = 10;
+    EXPECT_FALSE(csubarr.header().is_subarray());
+    EXPECT_EQ(2, csubarr.header().count());
+    const int rsubdata[] = { 10, 6 };
+    EXPECT_TRUE(computoc::all_equal(csubarr, Integer_array{ {2, 1}, rsubdata }));
+    EXPECT_EQ(4, arr({ 1, 1 }));
+
+    // a clone that outlived its source takes over the buffer without copying
+    Integer_array oarr{ computoc::clone(Integer_array{ {3, 2}, data }, computoc::copy_on_write) };
+    const int* odata = std::as_const(oarr).data();
+    oarr(0) = 7;
+    EXPECT_EQ(odata, oarr.data());
+
+    Integer_array empty_arr{};
+    EXPECT_TRUE(computoc::empty(computoc::clone(empty_arr, computoc::copy_on_write)));
+}
+
+TEST(Array_test, arena_allocation)
+{
+    using Arena_array = computoc::Array<int, computoc::dynamic_sequence, computoc::dynamic_sequence, computoc::Arena_allocator, computoc::Arena_allocator>;
+    using Integer_array = computoc::Array<int>;
+
+    const int data[] = { 1, 2, 3, 4, 5, 6 };
+
+    Arena_array heap_arr{ {3, 2}, data };
+    Integer_array result{};
+
+    {
+        computoc::Arena_scope scope{};
+        EXPECT_EQ(&scope, computoc::Arena_scope::current());
+        EXPECT_FALSE(scope.owns(heap_arr.data()));
+
+        Arena_array arr{ {3, 2}, data };
+        EXPECT_TRUE(scope.owns(arr.data()));
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(arr.data()) % computoc::Arena_scope::alignment);
+
+        Arena_array sum{ arr + heap_arr };
+        EXPECT_TRUE(scope.owns(sum.data()));
+
+        {
+            computoc::Arena_scope inner_scope{};
+            Arena_array tmp{ sum * 2 };
+            EXPECT_TRUE(inner_scope.owns(tmp.data()));
+            EXPECT_FALSE(scope.owns(tmp.data()));
+            copy(tmp, sum);
+        }
+        EXPECT_EQ(&scope, computoc::Arena_scope::current());
+
+        // a chunk larger than the default is allocated for large requests
+        Arena_array large{ {computoc::Arena_scope::chunk_size / 2, 2}, 1 };
+        EXPECT_TRUE(scope.owns(large.data()));
+
+        result = Integer_array{ sum - arr };
+    }
+    EXPECT_EQ(nullptr, computoc::Arena_scope::current());
+
+    const int rdata[] = { 3, 6, 9, 12, 15, 18 };
+    EXPECT_TRUE(computoc::all_equal(result, Integer_array{ {3, 2}, rdata }));
+    EXPECT_TRUE(computoc::all_equal(heap_arr, Arena_array{ {3, 2}, data }));
+}
+
 TEST(Array_test, copy)
 {
     using Integer_array = computoc::Array<int>;
@@ -3138,7 +4348,50 @@ TEST(Array_test, reshape)
 
         Integer_array rarr{ computoc::reshape(arr({{0, 2, 2}, {}, {}}), {1, 2}) };
         EXPECT_TRUE(computoc::all_equal(tarr, rarr));
-        EXPECT_NE(arr.data(), rarr.data());
+        EXPECT_EQ(arr.data(), rarr.data());
+        EXPECT_FALSE(computoc::reshape_copies(arr({{0, 2, 2}, {}, {}}), {1, 2}));
+    }
+
+    // subarrays are viewed with new strides when possible, and copied otherwise
+    {
+        const int mdata[] = {
+            1, 2, 3, 4,
+            5, 6, 7, 8,
+            9, 10, 11, 12 };
+        Integer_array marr{ {3, 4}, mdata };
+
+        Integer_array rows{ marr({ {1, 2} }) };
+        EXPECT_FALSE(computoc::reshape_copies(rows, { 4, 2 }));
+        Integer_array rrows{ computoc::reshape(rows, { 4, 2 }) };
+        const int rrows_data[] = { 5, 6, 7, 8, 9, 10, 11, 12 };
+        EXPECT_TRUE(computoc::all_equal(Integer_array({ 4, 2 }, rrows_data), rrows));
+        EXPECT_EQ(marr.data(), rrows.data());
+        rrows({ 0, 0 }) = 50;
+        EXPECT_EQ(50, marr({ 1, 0 }));
+        rrows({ 0, 0 }) = 5;
+
+        Integer_array strided_rows{ marr({ {0, 2, 2} }) };
+        EXPECT_FALSE(computoc::reshape_copies(strided_rows, { 2, 2, 2 }));
+        Integer_array rstrided_rows{ computoc::reshape(strided_rows, { 2, 2, 2 }) };
+        const int rstrided_rows_data[] = { 1, 2, 3, 4, 9, 10, 11, 12 };
+        EXPECT_TRUE(computoc::all_equal(Integer_array({ 2, 2, 2 }, rstrided_rows_data), rstrided_rows));
+        EXPECT_EQ(marr.data(), rstrided_rows.data());
+
+        EXPECT_TRUE(computoc::reshape_copies(strided_rows, { 8 }));
+        Integer_array rflat{ computoc::reshape(strided_rows, { 8 }) };
+        EXPECT_TRUE(computoc::all_equal(Integer_array({ 8 }, rstrided_rows_data), rflat));
+        EXPECT_NE(marr.data(), rflat.data());
+
+        Integer_array columns{ marr({ {0, 2}, {1, 2} }) };
+        EXPECT_TRUE(computoc::reshape_copies(columns, { 6 }));
+        EXPECT_FALSE(computoc::reshape_copies(columns, { 3, 1, 2 }));
+        Integer_array rcolumns{ computoc::reshape(columns, { 3, 1, 2 }) };
+        const int rcolumns_data[] = { 2, 3, 6, 7, 10, 11 };
+        EXPECT_TRUE(computoc::all_equal(Integer_array({ 3, 1, 2 }, rcolumns_data), rcolumns));
+        EXPECT_EQ(marr.data(), rcolumns.data());
+
+        EXPECT_FALSE(computoc::reshape_copies(marr, { 2, 6 }));
+        EXPECT_FALSE(computoc::reshape_copies(columns, { 7 }));
     }
 }
 
@@ -3294,6 +4547,168 @@ TEST(Array_test, append)
     }
 }
 
+TEST(Array_test, concatenate_and_stack)
+{
+    using Integer_array = computoc::Array<int>;
+
+    const int data[] = {
+        1, 2, 3,
+        4, 5, 6 };
+    const Integer_array a{ {2, 3}, data };
+    const Integer_array b{ {1, 3}, 7 };
+    const Integer_array c{ {2, 1}, 8 };
+
+    {
+        EXPECT_TRUE(computoc::empty(computoc::concatenate(std::span<const Integer_array>{})));
+        EXPECT_TRUE(computoc::empty(computoc::concatenate({ Integer_array{}, Integer_array{} })));
+        EXPECT_TRUE(computoc::empty(computoc::concatenate({ a, c })));
+        EXPECT_TRUE(computoc::all_equal(a, computoc::concatenate({ Integer_array{}, a })));
+    }
+
+    {
+        const int rdata[] = {
+            1, 2, 3,
+            4, 5, 6,
+            7, 7, 7,
+            1, 2, 3,
+            4, 5, 6 };
+        const Integer_array r{ {5, 3}, rdata };
+        EXPECT_TRUE(computoc::all_equal(r, computoc::concatenate({ a, b, Integer_array{}, a })));
+        EXPECT_TRUE(computoc::all_equal(computoc::append(computoc::append(a, b, 0), a, 0), r));
+    }
+
+    {
+        const int rdata[] = {
+            1, 2, 3, 8, 2, 3,
+            4, 5, 6, 8, 5, 6 };
+        const Integer_array r{ {2, 6}, rdata };
+        EXPECT_TRUE(computoc::all_equal(r, computoc::concatenate({ a, c, a({ {0, 1}, {1, 2} }) }, -1)));
+    }
+
+    {
+        std::vector<Integer_array> shards;
+        for (int i = 0; i < 64; ++i) {
+            shards.push_back(Integer_array({ 100, 3 }, i));
+        }
+        const Integer_array r{ computoc::concatenate(computoc::par, std::span<const Integer_array>(shards)) };
+        EXPECT_TRUE(computoc::all_equal(r, computoc::concatenate(std::span<const Integer_array>(shards))));
+        EXPECT_EQ(6400, r.header().dims()[0]);
+        EXPECT_EQ(0, r({ 99, 2 }));
+        EXPECT_EQ(63, r({ 6399, 0 }));
+    }
+
+    {
+        EXPECT_TRUE(computoc::empty(computoc::stack({ a, b })));
+
+        const int rdata0[] = {
+            1, 2, 3,
+            4, 5, 6,
+
+            1, 3, 3,
+            4, 6, 6 };
+        const Integer_array strided{ a({ {0, 1}, {0, 2, 2} }) };
+        const Integer_array r0{ {2, 2, 3}, rdata0 };
+        EXPECT_TRUE(computoc::all_equal(r0, computoc::stack({ a, computoc::concatenate({ strided({ {0, 1}, {0, 1} }), strided({ {0, 1}, {1, 1} }) }, 1) })));
+
+        const int rdata1[] = {
+            1, 2, 3,
+            1, 2, 3,
+
+            4, 5, 6,
+            4, 5, 6 };
+        const Integer_array r1{ {2, 2, 3}, rdata1 };
+        EXPECT_TRUE(computoc::all_equal(r1, computoc::stack({ a, a }, 1)));
+
+        const int rdata2[] = {
+            1, 1,
+            2, 2,
+            3, 3,
+
+            4, 4,
+            5, 5,
+            6, 6 };
+        const Integer_array r2{ {2, 3, 2}, rdata2 };
+        EXPECT_TRUE(computoc::all_equal(r2, computoc::stack(computoc::par, { a, a }, -1)));
+    }
+}
+
+TEST(Array_test, append_inplace)
+{
+    using Integer_array = computoc::Array<int>;
+
+    Integer_array arr{};
+    const int* prev_data{ nullptr };
+    std::int64_t num_reallocations{ 0 };
+
+    const std::int64_t num_rows{ 1000 };
+    for (int i = 0; i < num_rows; ++i) {
+        const int row_data[] = { i, -i, 2 * i };
+        arr.push_back(Integer_array{ {3}, row_data });
+        if (std::as_const(arr).data() != prev_data) {
+            ++num_reallocations;
+            prev_data = std::as_const(arr).data();
+        }
+    }
+    EXPECT_EQ((std::vector<std::int64_t>{ num_rows, 3 }), (std::vector<std::int64_t>(arr.header().dims().begin(), arr.header().dims().end())));
+    EXPECT_LT(num_reallocations, 25);
+    for (int i = 0; i < num_rows; ++i) {
+        EXPECT_EQ(i, arr({ i, 0 }));
+        EXPECT_EQ(-i, arr({ i, 1 }));
+        EXPECT_EQ(2 * i, arr({ i, 2 }));
+    }
+
+    // views sharing the buffer keep their elements
+    Integer_array first_rows{ arr({ {0, 1}, {0, 2} }) };
+    const int rows_data[] = { 7, 8, 9, 10, 11, 12 };
+    arr.append_inplace(Integer_array{ {2, 3}, rows_data });
+    EXPECT_EQ(num_rows + 2, arr.header().dims()[0]);
+    EXPECT_EQ(12, arr({ num_rows + 1, 2 }));
+    const int first_rows_data[] = { 0, 0, 0, 1, -1, 2 };
+    EXPECT_TRUE(computoc::all_equal(first_rows, Integer_array{ {2, 3}, first_rows_data }));
+
+    // an array sharing the buffer keeps it, along with its pointers and iterators
+    {
+        Integer_array grown{ {2, 3}, rows_data };
+        Integer_array shared{ grown };
+        const int* shared_data{ std::as_const(shared).data() };
+        auto it = shared.cbegin();
+        grown.push_back(Integer_array{ {3}, rows_data });
+        EXPECT_NE(shared_data, std::as_const(grown).data());
+        EXPECT_EQ(shared_data, std::as_const(shared).data());
+        EXPECT_EQ(2, shared.header().dims()[0]);
+        EXPECT_EQ(7, *it);
+        EXPECT_EQ(12, *(it + 5));
+        EXPECT_EQ(9, grown({ 2, 2 }));
+
+        // appending an array to itself
+        shared.append_inplace(shared);
+        const int self_data[] = { 7, 8, 9, 10, 11, 12, 7, 8, 9, 10, 11, 12 };
+        EXPECT_TRUE(computoc::all_equal(shared, Integer_array{ {4, 3}, self_data }));
+    }
+
+    // mismatching rows are not appended
+    arr.append_inplace(Integer_array{ {2, 2}, 0 });
+    arr.push_back(5);
+    EXPECT_EQ(num_rows + 2, arr.header().dims()[0]);
+
+    // a subarray is copied before growing
+    const int data[] = { 1, 2, 3, 4, 5, 6 };
+    Integer_array src{ {6}, data };
+    Integer_array sarr{ src({ {0, 5, 2} }) };
+    sarr.push_back(7);
+    sarr.append_inplace(sarr);
+    const int rdata[] = { 1, 3, 5, 7, 1, 3, 5, 7 };
+    EXPECT_TRUE(computoc::all_equal(sarr, Integer_array{ {8}, rdata }));
+    EXPECT_TRUE(computoc::all_equal(src, Integer_array{ {6}, data }));
+
+    Integer_array values{};
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(100, values.header().count());
+    EXPECT_EQ(99, values({ 99 }));
+}
+
 TEST(Array_test, insert)
 {
     using Integer_array = computoc::Array<int>;
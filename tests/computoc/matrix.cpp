@@ -148,6 +148,11 @@ TEST(Matrix_test, can_return_its_header_and_data)
     for (std::size_t i = 0; i < computoc::product(dims); ++i) {
         EXPECT_EQ(0, mat.data()[i]);
     }
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(mat.data()) % computoc::matrix_alignment);
+
+    const computoc::Dims large_dims = { 1, 20, 30 };
+    Integer_matrix large_mat{ large_dims, value };
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(large_mat.data()) % computoc::matrix_alignment);
 }
 
 TEST(Matrix_test, have_read_write_access_to_its_cells)
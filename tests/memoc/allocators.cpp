@@ -54,6 +54,42 @@ TEST_F(Malloc_allocator_test, failed_to_allocate_if_invalid_size)
     //EXPECT_EQ(Allocator_error::unknown, allocator_.allocate(std::numeric_limits<Block<void>::Size_type>::max()).error());
 }
 
+// Aligned_malloc_allocator tests
+
+class Aligned_malloc_allocator_test : public ::testing::Test {
+protected:
+    static constexpr memoc::Block<void>::Size_type alignment_ = 64;
+
+    using Allocator = memoc::Aligned_malloc_allocator<alignment_>;
+    Allocator allocator_{};
+};
+
+TEST_F(Aligned_malloc_allocator_test, allocates_aligned_memory_of_any_size_successfully)
+{
+    using namespace memoc;
+
+    static_assert(Aligned_allocator<Allocator, alignment_>);
+    static_assert(!Aligned_allocator<Malloc_allocator, alignment_>);
+
+    EXPECT_FALSE(allocator_.owns(Block<void>{}));
+
+    for (Block<void>::Size_type s : { 1, 63, 64, 100, 4096 }) {
+        Block<void> b = allocator_.allocate(s).value();
+        EXPECT_NE(nullptr, b.data());
+        EXPECT_EQ(s, b.size());
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(b.data()) % alignment_);
+
+        EXPECT_TRUE(allocator_.owns(b));
+        EXPECT_FALSE(Malloc_allocator{}.owns(b));
+
+        allocator_.deallocate(b);
+        EXPECT_TRUE(b.empty());
+    }
+
+    EXPECT_TRUE(allocator_.allocate(0).value().empty());
+    EXPECT_EQ(Allocator_error::invalid_size, allocator_.allocate(-1).error());
+}
+
 // Stack_allocator tests
 
 class Stack_allocator_test : public ::testing::Test {
@@ -129,6 +165,35 @@ TEST_F(Stack_allocator_test, reuses_the_same_memory_if_deallocating_between_two_
     EXPECT_TRUE(b2.empty());
 }
 
+TEST_F(Stack_allocator_test, allocates_aligned_memory_from_aligned_stack_memory)
+{
+    using namespace memoc;
+
+    constexpr Block<void>::Size_type alignment{ 64 };
+    using Aligned_stack_allocator = Stack_allocator<details::Default_global_stack_memory<1, 4 * alignment, alignment>, alignment>;
+    static_assert(Aligned_allocator<Aligned_stack_allocator, alignment>);
+
+    Aligned_stack_allocator allocator{};
+
+    Block<void> b1 = allocator.allocate(3).value();
+    Block<void> b2 = allocator.allocate(alignment + 1).value();
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(b1.data()) % alignment);
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(b2.data()) % alignment);
+    EXPECT_EQ(alignment, reinterpret_cast<std::uint8_t*>(b2.data()) - reinterpret_cast<std::uint8_t*>(b1.data()));
+
+    // the remaining memory is smaller than the aligned size
+    EXPECT_EQ(Allocator_error::out_of_memory, allocator.allocate(alignment + 1).error());
+
+    allocator.deallocate(b2);
+    allocator.deallocate(b1);
+    EXPECT_TRUE(b1.empty());
+    EXPECT_TRUE(b2.empty());
+
+    Block<void> b3 = allocator.allocate(4 * alignment).value();
+    EXPECT_EQ(4 * alignment, b3.size());
+    allocator.deallocate(b3);
+}
+
 TEST_F(Stack_allocator_test, fails_to_allocate_memory_bigger_than_memory_size)
 {
     using namespace memoc;